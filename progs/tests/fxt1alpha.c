@@ -0,0 +1,176 @@
+/*
+ * Test that GL_COMPRESSED_RGB_FXT1_3DFX textures are sampled as opaque.
+ *
+ * Some FXT1 block modes can encode transparent texels: the HI mode with
+ * index 7 and the MIXED mode with the alpha bit set.  Decoded as RGB
+ * their alpha must be 1; decoded as RGBA it must stay 0.  Each texture
+ * is drawn with its alpha routed through GL_COMBINE and blended over a
+ * red background, so transparent texels show up red.
+ */
+
+
+#define GL_GLEXT_PROTOTYPES
+#include <stdio.h>
+#include <stdlib.h>
+#include <GL/glut.h>
+
+
+#define TEX_WIDTH 16
+#define TEX_HEIGHT 4
+
+static GLint WinWidth = 2 * TEX_WIDTH, WinHeight = TEX_HEIGHT;
+
+/**
+ * Two 8x4 blocks.  The first is a HI block with every index 7, the
+ * second a MIXED block with the alpha bit set and every index 3.  All
+ * of their texels decode to transparent black.
+ */
+static const GLubyte Blocks[32] = {
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90
+};
+
+static GLuint Textures[2];
+
+
+static void
+DrawTexture(GLuint tex, GLint x)
+{
+   glBindTexture(GL_TEXTURE_2D, tex);
+   glBegin(GL_QUADS);
+   glTexCoord2f(0, 0);  glVertex2i(x, 0);
+   glTexCoord2f(1, 0);  glVertex2i(x + TEX_WIDTH, 0);
+   glTexCoord2f(1, 1);  glVertex2i(x + TEX_WIDTH, TEX_HEIGHT);
+   glTexCoord2f(0, 1);  glVertex2i(x, TEX_HEIGHT);
+   glEnd();
+}
+
+
+/**
+ * Count the texels of a drawn texture which let the background through.
+ */
+static int
+CountTransparent(GLint x)
+{
+   GLubyte pixels[TEX_WIDTH * TEX_HEIGHT][4];
+   int i, count = 0;
+
+   glReadPixels(x, 0, TEX_WIDTH, TEX_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE,
+                pixels);
+   for (i = 0; i < TEX_WIDTH * TEX_HEIGHT; i++) {
+      if (pixels[i][0] > 127)
+         count++;
+   }
+   return count;
+}
+
+
+static void
+Display(void)
+{
+   int rgb, rgba;
+
+   glClear(GL_COLOR_BUFFER_BIT);
+
+   DrawTexture(Textures[0], 0);
+   DrawTexture(Textures[1], TEX_WIDTH);
+
+   rgb = CountTransparent(0);
+   rgba = CountTransparent(TEX_WIDTH);
+   printf("RGB_FXT1: %d of %d texels transparent (expected 0)\n",
+          rgb, TEX_WIDTH * TEX_HEIGHT);
+   printf("RGBA_FXT1: %d of %d texels transparent (expected %d)\n",
+          rgba, TEX_WIDTH * TEX_HEIGHT, TEX_WIDTH * TEX_HEIGHT);
+   printf("%s\n", (rgb == 0 && rgba == TEX_WIDTH * TEX_HEIGHT)
+          ? "PASS" : "FAIL");
+
+   glutSwapBuffers();
+}
+
+
+static void
+Reshape(int width, int height)
+{
+   WinWidth = width;
+   WinHeight = height;
+   glViewport(0, 0, width, height);
+   glMatrixMode(GL_PROJECTION);
+   glLoadIdentity();
+   glOrtho(0, width, 0, height, -1, 1);
+   glMatrixMode(GL_MODELVIEW);
+   glLoadIdentity();
+}
+
+
+static void
+Key(unsigned char key, int x, int y)
+{
+   (void) x;
+   (void) y;
+   switch (key) {
+      case 27:
+         exit(0);
+         break;
+   }
+   glutPostRedisplay();
+}
+
+
+static void
+Init(void)
+{
+   static const GLenum formats[2] = {
+      GL_COMPRESSED_RGB_FXT1_3DFX,
+      GL_COMPRESSED_RGBA_FXT1_3DFX
+   };
+   int i;
+
+   if (!glutExtensionSupported("GL_3DFX_texture_compression_FXT1")) {
+      printf("Sorry, GL_3DFX_texture_compression_FXT1 not supported\n");
+      exit(0);
+   }
+
+   printf("GL_RENDERER = %s\n", (char *) glGetString(GL_RENDERER));
+
+   glGenTextures(2, Textures);
+   for (i = 0; i < 2; i++) {
+      glBindTexture(GL_TEXTURE_2D, Textures[i]);
+      glCompressedTexImage2DARB(GL_TEXTURE_2D, 0, formats[i],
+                                TEX_WIDTH, TEX_HEIGHT, 0,
+                                sizeof(Blocks), Blocks);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   }
+
+   /* GL_REPLACE would take alpha from the fragment for RGB textures */
+   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE_ARB);
+   glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB_ARB, GL_REPLACE);
+   glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA_ARB, GL_REPLACE);
+   glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB_ARB, GL_TEXTURE);
+   glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_ALPHA_ARB, GL_TEXTURE);
+   glEnable(GL_TEXTURE_2D);
+
+   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+   glEnable(GL_BLEND);
+
+   glClearColor(1.0, 0.0, 0.0, 1.0);
+}
+
+
+int
+main(int argc, char *argv[])
+{
+   glutInit(&argc, argv);
+   glutInitWindowPosition(0, 0);
+   glutInitWindowSize(WinWidth, WinHeight);
+   glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE);
+   glutCreateWindow(argv[0]);
+   glutReshapeFunc(Reshape);
+   glutKeyboardFunc(Key);
+   glutDisplayFunc(Display);
+   Init();
+   glutMainLoop();
+   return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * Measure texture compression (glTexImage2D with a compressed internal
+ * format) speed, compared to uncompressed texture uploads.
+ *
+ * A 4096 x 4096 image is uploaded as four 2048 x 2048 textures, since
+ * that's the largest texture size Mesa supports.
+ * Use the -rgb option to test RGB instead of RGBA images.
+ * With Mesa, setting MESA_THREADS controls how many threads the
+ * FXT1 encoder uses.
+ */
+
+#define GL_GLEXT_PROTOTYPES
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <GL/glut.h>
+
+#define IMAGE_SIZE 4096
+#define TEX_SIZE 2048
+
+static GLuint TexObj = 1;
+static GLubyte *Image = NULL;
+static GLenum ImageFormat = GL_RGBA;
+
+
+/**
+ * Make an image with some structure and some noise in it, so the
+ * encoder can't take any shortcuts.
+ */
+static void
+MakeImage(void)
+{
+   int i, j;
+
+   Image = (GLubyte *) malloc(IMAGE_SIZE * IMAGE_SIZE * 4);
+   for (i = 0; i < IMAGE_SIZE; i++) {
+      for (j = 0; j < IMAGE_SIZE; j++) {
+         GLubyte *p = Image + (i * IMAGE_SIZE + j) * 4;
+         p[0] = (j * 7 + i + (rand() & 63)) & 255;
+         p[1] = (i * 3) ^ (j >> 2);
+         p[2] = ((i * j) >> 6) + (rand() & 15);
+         p[3] = ((i + j) % 300 < 40) ? ((i * j) & 255) : 255;
+      }
+   }
+}
+
+
+/**
+ * Upload the whole image, in four pieces, with the given internal format.
+ */
+static void
+UploadImage(GLenum intFormat)
+{
+   int x, y;
+
+   glPixelStorei(GL_UNPACK_ROW_LENGTH, IMAGE_SIZE);
+   for (y = 0; y < IMAGE_SIZE; y += TEX_SIZE) {
+      for (x = 0; x < IMAGE_SIZE; x += TEX_SIZE) {
+         glPixelStorei(GL_UNPACK_SKIP_ROWS, y);
+         glPixelStorei(GL_UNPACK_SKIP_PIXELS, x);
+         glTexImage2D(GL_TEXTURE_2D, 0, intFormat, TEX_SIZE, TEX_SIZE, 0,
+                      GL_RGBA, GL_UNSIGNED_BYTE, Image);
+      }
+   }
+   glFinish();
+}
+
+
+/**
+ * Measure upload rate for the given internal format.
+ */
+static void
+RunTest(GLenum intFormat, const char *name)
+{
+   double t0, t1;
+   int iters = 0;
+   GLint compressed = 0;
+
+   t0 = glutGet(GLUT_ELAPSED_TIME) / 1000.0;
+   do {
+      UploadImage(intFormat);
+      iters++;
+      t1 = glutGet(GLUT_ELAPSED_TIME) / 1000.0;
+   } while (t1 - t0 < 5.0);
+
+   glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED_ARB,
+                            &compressed);
+
+   printf("%s (%s): %d x %d image:\n", name,
+          compressed ? "compressed" : "not compressed",
+          IMAGE_SIZE, IMAGE_SIZE);
+   printf("   %d uploads in %.2f = %.3f sec/image, %.2f MTexels/s\n",
+          iters, t1 - t0, (t1 - t0) / iters,
+          iters * (IMAGE_SIZE / 1024.0) * (IMAGE_SIZE / 1024.0) / (t1 - t0));
+}
+
+
+static void
+Draw(void)
+{
+   const char *ext = (const char *) glGetString(GL_EXTENSIONS);
+
+   glClearColor(0.2, 0.2, 0.8, 0);
+   glClear(GL_COLOR_BUFFER_BIT);
+   glutSwapBuffers();
+
+   if (ImageFormat == GL_RGB) {
+      RunTest(GL_RGB8, "GL_RGB8");
+      if (strstr(ext, "GL_3DFX_texture_compression_FXT1"))
+         RunTest(GL_COMPRESSED_RGB_FXT1_3DFX, "GL_COMPRESSED_RGB_FXT1_3DFX");
+      RunTest(GL_COMPRESSED_RGB_ARB, "GL_COMPRESSED_RGB_ARB");
+   }
+   else {
+      RunTest(GL_RGBA8, "GL_RGBA8");
+      if (strstr(ext, "GL_3DFX_texture_compression_FXT1"))
+         RunTest(GL_COMPRESSED_RGBA_FXT1_3DFX, "GL_COMPRESSED_RGBA_FXT1_3DFX");
+      RunTest(GL_COMPRESSED_RGBA_ARB, "GL_COMPRESSED_RGBA_ARB");
+   }
+
+   printf("exiting\n");
+   exit(0);
+}
+
+
+static void
+Key(unsigned char key, int x, int y)
+{
+   (void) x;
+   (void) y;
+   switch (key) {
+      case 27:
+         exit(0);
+         break;
+   }
+   glutPostRedisplay();
+}
+
+
+static void
+Init(void)
+{
+   const char *ext = (const char *) glGetString(GL_EXTENSIONS);
+
+   if (!strstr(ext, "GL_ARB_texture_compression")) {
+      printf("Sorry, GL_ARB_texture_compression not supported\n");
+      exit(1);
+   }
+
+   MakeImage();
+   glBindTexture(GL_TEXTURE_2D, TexObj);
+   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
+
+
+static void
+ParseArgs(int argc, char *argv[])
+{
+   int i;
+   for (i = 1; i < argc; i++) {
+      if (strcmp(argv[i], "-rgb") == 0)
+         ImageFormat = GL_RGB;
+   }
+}
+
+
+int
+main(int argc, char *argv[])
+{
+   glutInit(&argc, argv);
+
+   ParseArgs(argc, argv);
+
+   glutInitWindowPosition(0, 0);
+   glutInitWindowSize(300, 300);
+   glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE);
+   glutCreateWindow(argv[0]);
+   glutKeyboardFunc(Key);
+   glutDisplayFunc(Draw);
+
+   printf("GL_RENDERER: %s\n", (char *) glGetString(GL_RENDERER));
+   Init();
+
+   glutMainLoop();
+   return 0;
+}
@@ -911,10 +911,10 @@ static const char Uniform3iARB_names[] =
     "";
 #endif
 
-#if defined(need_GL_SGIX_fragment_lighting)
-static const char GetFragmentMaterialfvSGIX_names[] = 
-    "iip\0" /* Parameter signature */
-    "glGetFragmentMaterialfvSGIX\0"
+#if defined(need_GL_ARB_draw_instanced)
+static const char DrawElementsInstancedARB_names[] = 
+    "iiipi\0" /* Parameter signature */
+    "glDrawElementsInstancedARB\0"
     "";
 #endif
 
@@ -2302,6 +2302,13 @@ static const char SecondaryColor3ivEXT_names[] =
     "";
 #endif
 
+#if defined(need_GL_SGIX_fragment_lighting)
+static const char GetFragmentMaterialfvSGIX_names[] = 
+    "iip\0" /* Parameter signature */
+    "glGetFragmentMaterialfvSGIX\0"
+    "";
+#endif
+
 #if defined(need_GL_VERSION_2_1)
 static const char UniformMatrix4x2fv_names[] = 
     "iiip\0" /* Parameter signature */
@@ -2562,6 +2569,13 @@ static const char VertexAttrib4NivARB_names[] =
     "";
 #endif
 
+#if defined(need_GL_ARB_draw_instanced)
+static const char DrawArraysInstancedARB_names[] = 
+    "iiii\0" /* Parameter signature */
+    "glDrawArraysInstancedARB\0"
+    "";
+#endif
+
 #if defined(need_GL_VERSION_2_0)
 static const char GetAttachedShaders_names[] = 
     "iipp\0" /* Parameter signature */
@@ -3381,6 +3395,13 @@ static const char FragmentLightfvSGIX_names[] =
     "";
 #endif
 
+#if defined(need_GL_ARB_instanced_arrays)
+static const char VertexAttribDivisorARB_names[] = 
+    "ii\0" /* Parameter signature */
+    "glVertexAttribDivisorARB\0"
+    "";
+#endif
+
 #if defined(need_GL_VERSION_2_0)
 static const char DetachShader_names[] = 
     "ii\0" /* Parameter signature */
@@ -4892,6 +4913,21 @@ static const struct dri_extension_function GL_ARB_draw_buffers_functions[] = {
 };
 #endif
 
+#if defined(need_GL_ARB_draw_instanced)
+static const struct dri_extension_function GL_ARB_draw_instanced_functions[] = {
+    { DrawElementsInstancedARB_names, DrawElementsInstancedARB_remap_index, -1 },
+    { DrawArraysInstancedARB_names, DrawArraysInstancedARB_remap_index, -1 },
+    { NULL, 0, 0 }
+};
+#endif
+
+#if defined(need_GL_ARB_instanced_arrays)
+static const struct dri_extension_function GL_ARB_instanced_arrays_functions[] = {
+    { VertexAttribDivisorARB_names, VertexAttribDivisorARB_remap_index, -1 },
+    { NULL, 0, 0 }
+};
+#endif
+
 #if defined(need_GL_ARB_matrix_palette)
 static const struct dri_extension_function GL_ARB_matrix_palette_functions[] = {
     { MatrixIndexusvARB_names, MatrixIndexusvARB_remap_index, -1 },
@@ -5898,12 +5934,12 @@ static const struct dri_extension_function GL_SGIX_fragment_lighting_functions[]
     { FragmentMaterialfvSGIX_names, FragmentMaterialfvSGIX_remap_index, -1 },
     { FragmentLightModelivSGIX_names, FragmentLightModelivSGIX_remap_index, -1 },
     { FragmentLightiSGIX_names, FragmentLightiSGIX_remap_index, -1 },
-    { GetFragmentMaterialfvSGIX_names, GetFragmentMaterialfvSGIX_remap_index, -1 },
     { FragmentMaterialfSGIX_names, FragmentMaterialfSGIX_remap_index, -1 },
     { GetFragmentLightivSGIX_names, GetFragmentLightivSGIX_remap_index, -1 },
     { FragmentLightModeliSGIX_names, FragmentLightModeliSGIX_remap_index, -1 },
     { FragmentLightivSGIX_names, FragmentLightivSGIX_remap_index, -1 },
     { GetFragmentMaterialivSGIX_names, GetFragmentMaterialivSGIX_remap_index, -1 },
+    { GetFragmentMaterialfvSGIX_names, GetFragmentMaterialfvSGIX_remap_index, -1 },
     { FragmentLightModelfSGIX_names, FragmentLightModelfSGIX_remap_index, -1 },
     { FragmentColorMaterialSGIX_names, FragmentColorMaterialSGIX_remap_index, -1 },
     { FragmentMaterialiSGIX_names, FragmentMaterialiSGIX_remap_index, -1 },
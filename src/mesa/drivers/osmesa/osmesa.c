@@ -820,6 +820,24 @@ osmesa_delete_renderbuffer(struct gl_renderbuffer *rb)
 }
 
 
+/**
+ * Direct access to the user's buffer, for the OSMESA_RGBA format only
+ * since that's the pixel layout swrast assumes.
+ */
+static void *
+get_pointer_RGBA(GLcontext *ctx, struct gl_renderbuffer *rb, GLint x, GLint y)
+{
+   const OSMesaContext osmesa = OSMESA_CONTEXT(ctx);
+
+   if (rb->DataType == GL_UNSIGNED_BYTE)
+      return (GLubyte *) osmesa->rowaddr[y] + 4 * x;
+   else if (rb->DataType == GL_UNSIGNED_SHORT)
+      return (GLushort *) osmesa->rowaddr[y] + 4 * x;
+   else
+      return (GLfloat *) osmesa->rowaddr[y] + 4 * x;
+}
+
+
 /**
  * Allocate renderbuffer storage.  We don't actually allocate any storage
  * since we're using a user-provided buffer.
@@ -875,6 +893,7 @@ osmesa_renderbuffer_storage(GLcontext *ctx, struct gl_renderbuffer *rb,
          rb->PutValues = put_values_RGBA32;
          rb->PutMonoValues = put_mono_values_RGBA32;
       }
+      rb->GetPointer = get_pointer_RGBA;
       rb->RedBits = rb->GreenBits = rb->BlueBits = rb->AlphaBits = bpc;
    }
    else if (osmesa->format == OSMESA_BGRA) {
@@ -1744,6 +1744,15 @@
 #define CALL_DrawBuffersARB(disp, parameters) (*((disp)->DrawBuffersARB)) parameters
 #define GET_DrawBuffersARB(disp) ((disp)->DrawBuffersARB)
 #define SET_DrawBuffersARB(disp, fn) ((disp)->DrawBuffersARB = fn)
+#define CALL_DrawArraysInstancedARB(disp, parameters) (*((disp)->DrawArraysInstancedARB)) parameters
+#define GET_DrawArraysInstancedARB(disp) ((disp)->DrawArraysInstancedARB)
+#define SET_DrawArraysInstancedARB(disp, fn) ((disp)->DrawArraysInstancedARB = fn)
+#define CALL_DrawElementsInstancedARB(disp, parameters) (*((disp)->DrawElementsInstancedARB)) parameters
+#define GET_DrawElementsInstancedARB(disp) ((disp)->DrawElementsInstancedARB)
+#define SET_DrawElementsInstancedARB(disp, fn) ((disp)->DrawElementsInstancedARB = fn)
+#define CALL_VertexAttribDivisorARB(disp, parameters) (*((disp)->VertexAttribDivisorARB)) parameters
+#define GET_VertexAttribDivisorARB(disp) ((disp)->VertexAttribDivisorARB)
+#define SET_VertexAttribDivisorARB(disp, fn) ((disp)->VertexAttribDivisorARB = fn)
 #define CALL_PolygonOffsetEXT(disp, parameters) (*((disp)->PolygonOffsetEXT)) parameters
 #define GET_PolygonOffsetEXT(disp) ((disp)->PolygonOffsetEXT)
 #define SET_PolygonOffsetEXT(disp, fn) ((disp)->PolygonOffsetEXT = fn)
@@ -2374,7 +2383,7 @@
 
 #else
 
-#define driDispatchRemapTable_size 362
+#define driDispatchRemapTable_size 365
 extern int driDispatchRemapTable[ driDispatchRemapTable_size ];
 
 #define AttachShader_remap_index 0
@@ -2530,215 +2539,218 @@ extern int driDispatchRemapTable[ driDispatchRemapTable_size ];
 #define GetActiveAttribARB_remap_index 150
 #define GetAttribLocationARB_remap_index 151
 #define DrawBuffersARB_remap_index 152
-#define PolygonOffsetEXT_remap_index 153
-#define GetPixelTexGenParameterfvSGIS_remap_index 154
-#define GetPixelTexGenParameterivSGIS_remap_index 155
-#define PixelTexGenParameterfSGIS_remap_index 156
-#define PixelTexGenParameterfvSGIS_remap_index 157
-#define PixelTexGenParameteriSGIS_remap_index 158
-#define PixelTexGenParameterivSGIS_remap_index 159
-#define SampleMaskSGIS_remap_index 160
-#define SamplePatternSGIS_remap_index 161
-#define ColorPointerEXT_remap_index 162
-#define EdgeFlagPointerEXT_remap_index 163
-#define IndexPointerEXT_remap_index 164
-#define NormalPointerEXT_remap_index 165
-#define TexCoordPointerEXT_remap_index 166
-#define VertexPointerEXT_remap_index 167
-#define PointParameterfEXT_remap_index 168
-#define PointParameterfvEXT_remap_index 169
-#define LockArraysEXT_remap_index 170
-#define UnlockArraysEXT_remap_index 171
-#define CullParameterdvEXT_remap_index 172
-#define CullParameterfvEXT_remap_index 173
-#define SecondaryColor3bEXT_remap_index 174
-#define SecondaryColor3bvEXT_remap_index 175
-#define SecondaryColor3dEXT_remap_index 176
-#define SecondaryColor3dvEXT_remap_index 177
-#define SecondaryColor3fEXT_remap_index 178
-#define SecondaryColor3fvEXT_remap_index 179
-#define SecondaryColor3iEXT_remap_index 180
-#define SecondaryColor3ivEXT_remap_index 181
-#define SecondaryColor3sEXT_remap_index 182
-#define SecondaryColor3svEXT_remap_index 183
-#define SecondaryColor3ubEXT_remap_index 184
-#define SecondaryColor3ubvEXT_remap_index 185
-#define SecondaryColor3uiEXT_remap_index 186
-#define SecondaryColor3uivEXT_remap_index 187
-#define SecondaryColor3usEXT_remap_index 188
-#define SecondaryColor3usvEXT_remap_index 189
-#define SecondaryColorPointerEXT_remap_index 190
-#define MultiDrawArraysEXT_remap_index 191
-#define MultiDrawElementsEXT_remap_index 192
-#define FogCoordPointerEXT_remap_index 193
-#define FogCoorddEXT_remap_index 194
-#define FogCoorddvEXT_remap_index 195
-#define FogCoordfEXT_remap_index 196
-#define FogCoordfvEXT_remap_index 197
-#define PixelTexGenSGIX_remap_index 198
-#define BlendFuncSeparateEXT_remap_index 199
-#define FlushVertexArrayRangeNV_remap_index 200
-#define VertexArrayRangeNV_remap_index 201
-#define CombinerInputNV_remap_index 202
-#define CombinerOutputNV_remap_index 203
-#define CombinerParameterfNV_remap_index 204
-#define CombinerParameterfvNV_remap_index 205
-#define CombinerParameteriNV_remap_index 206
-#define CombinerParameterivNV_remap_index 207
-#define FinalCombinerInputNV_remap_index 208
-#define GetCombinerInputParameterfvNV_remap_index 209
-#define GetCombinerInputParameterivNV_remap_index 210
-#define GetCombinerOutputParameterfvNV_remap_index 211
-#define GetCombinerOutputParameterivNV_remap_index 212
-#define GetFinalCombinerInputParameterfvNV_remap_index 213
-#define GetFinalCombinerInputParameterivNV_remap_index 214
-#define ResizeBuffersMESA_remap_index 215
-#define WindowPos2dMESA_remap_index 216
-#define WindowPos2dvMESA_remap_index 217
-#define WindowPos2fMESA_remap_index 218
-#define WindowPos2fvMESA_remap_index 219
-#define WindowPos2iMESA_remap_index 220
-#define WindowPos2ivMESA_remap_index 221
-#define WindowPos2sMESA_remap_index 222
-#define WindowPos2svMESA_remap_index 223
-#define WindowPos3dMESA_remap_index 224
-#define WindowPos3dvMESA_remap_index 225
-#define WindowPos3fMESA_remap_index 226
-#define WindowPos3fvMESA_remap_index 227
-#define WindowPos3iMESA_remap_index 228
-#define WindowPos3ivMESA_remap_index 229
-#define WindowPos3sMESA_remap_index 230
-#define WindowPos3svMESA_remap_index 231
-#define WindowPos4dMESA_remap_index 232
-#define WindowPos4dvMESA_remap_index 233
-#define WindowPos4fMESA_remap_index 234
-#define WindowPos4fvMESA_remap_index 235
-#define WindowPos4iMESA_remap_index 236
-#define WindowPos4ivMESA_remap_index 237
-#define WindowPos4sMESA_remap_index 238
-#define WindowPos4svMESA_remap_index 239
-#define MultiModeDrawArraysIBM_remap_index 240
-#define MultiModeDrawElementsIBM_remap_index 241
-#define DeleteFencesNV_remap_index 242
-#define FinishFenceNV_remap_index 243
-#define GenFencesNV_remap_index 244
-#define GetFenceivNV_remap_index 245
-#define IsFenceNV_remap_index 246
-#define SetFenceNV_remap_index 247
-#define TestFenceNV_remap_index 248
-#define AreProgramsResidentNV_remap_index 249
-#define BindProgramNV_remap_index 250
-#define DeleteProgramsNV_remap_index 251
-#define ExecuteProgramNV_remap_index 252
-#define GenProgramsNV_remap_index 253
-#define GetProgramParameterdvNV_remap_index 254
-#define GetProgramParameterfvNV_remap_index 255
-#define GetProgramStringNV_remap_index 256
-#define GetProgramivNV_remap_index 257
-#define GetTrackMatrixivNV_remap_index 258
-#define GetVertexAttribPointervNV_remap_index 259
-#define GetVertexAttribdvNV_remap_index 260
-#define GetVertexAttribfvNV_remap_index 261
-#define GetVertexAttribivNV_remap_index 262
-#define IsProgramNV_remap_index 263
-#define LoadProgramNV_remap_index 264
-#define ProgramParameters4dvNV_remap_index 265
-#define ProgramParameters4fvNV_remap_index 266
-#define RequestResidentProgramsNV_remap_index 267
-#define TrackMatrixNV_remap_index 268
-#define VertexAttrib1dNV_remap_index 269
-#define VertexAttrib1dvNV_remap_index 270
-#define VertexAttrib1fNV_remap_index 271
-#define VertexAttrib1fvNV_remap_index 272
-#define VertexAttrib1sNV_remap_index 273
-#define VertexAttrib1svNV_remap_index 274
-#define VertexAttrib2dNV_remap_index 275
-#define VertexAttrib2dvNV_remap_index 276
-#define VertexAttrib2fNV_remap_index 277
-#define VertexAttrib2fvNV_remap_index 278
-#define VertexAttrib2sNV_remap_index 279
-#define VertexAttrib2svNV_remap_index 280
-#define VertexAttrib3dNV_remap_index 281
-#define VertexAttrib3dvNV_remap_index 282
-#define VertexAttrib3fNV_remap_index 283
-#define VertexAttrib3fvNV_remap_index 284
-#define VertexAttrib3sNV_remap_index 285
-#define VertexAttrib3svNV_remap_index 286
-#define VertexAttrib4dNV_remap_index 287
-#define VertexAttrib4dvNV_remap_index 288
-#define VertexAttrib4fNV_remap_index 289
-#define VertexAttrib4fvNV_remap_index 290
-#define VertexAttrib4sNV_remap_index 291
-#define VertexAttrib4svNV_remap_index 292
-#define VertexAttrib4ubNV_remap_index 293
-#define VertexAttrib4ubvNV_remap_index 294
-#define VertexAttribPointerNV_remap_index 295
-#define VertexAttribs1dvNV_remap_index 296
-#define VertexAttribs1fvNV_remap_index 297
-#define VertexAttribs1svNV_remap_index 298
-#define VertexAttribs2dvNV_remap_index 299
-#define VertexAttribs2fvNV_remap_index 300
-#define VertexAttribs2svNV_remap_index 301
-#define VertexAttribs3dvNV_remap_index 302
-#define VertexAttribs3fvNV_remap_index 303
-#define VertexAttribs3svNV_remap_index 304
-#define VertexAttribs4dvNV_remap_index 305
-#define VertexAttribs4fvNV_remap_index 306
-#define VertexAttribs4svNV_remap_index 307
-#define VertexAttribs4ubvNV_remap_index 308
-#define AlphaFragmentOp1ATI_remap_index 309
-#define AlphaFragmentOp2ATI_remap_index 310
-#define AlphaFragmentOp3ATI_remap_index 311
-#define BeginFragmentShaderATI_remap_index 312
-#define BindFragmentShaderATI_remap_index 313
-#define ColorFragmentOp1ATI_remap_index 314
-#define ColorFragmentOp2ATI_remap_index 315
-#define ColorFragmentOp3ATI_remap_index 316
-#define DeleteFragmentShaderATI_remap_index 317
-#define EndFragmentShaderATI_remap_index 318
-#define GenFragmentShadersATI_remap_index 319
-#define PassTexCoordATI_remap_index 320
-#define SampleMapATI_remap_index 321
-#define SetFragmentShaderConstantATI_remap_index 322
-#define PointParameteriNV_remap_index 323
-#define PointParameterivNV_remap_index 324
-#define ActiveStencilFaceEXT_remap_index 325
-#define BindVertexArrayAPPLE_remap_index 326
-#define DeleteVertexArraysAPPLE_remap_index 327
-#define GenVertexArraysAPPLE_remap_index 328
-#define IsVertexArrayAPPLE_remap_index 329
-#define GetProgramNamedParameterdvNV_remap_index 330
-#define GetProgramNamedParameterfvNV_remap_index 331
-#define ProgramNamedParameter4dNV_remap_index 332
-#define ProgramNamedParameter4dvNV_remap_index 333
-#define ProgramNamedParameter4fNV_remap_index 334
-#define ProgramNamedParameter4fvNV_remap_index 335
-#define DepthBoundsEXT_remap_index 336
-#define BlendEquationSeparateEXT_remap_index 337
-#define BindFramebufferEXT_remap_index 338
-#define BindRenderbufferEXT_remap_index 339
-#define CheckFramebufferStatusEXT_remap_index 340
-#define DeleteFramebuffersEXT_remap_index 341
-#define DeleteRenderbuffersEXT_remap_index 342
-#define FramebufferRenderbufferEXT_remap_index 343
-#define FramebufferTexture1DEXT_remap_index 344
-#define FramebufferTexture2DEXT_remap_index 345
-#define FramebufferTexture3DEXT_remap_index 346
-#define GenFramebuffersEXT_remap_index 347
-#define GenRenderbuffersEXT_remap_index 348
-#define GenerateMipmapEXT_remap_index 349
-#define GetFramebufferAttachmentParameterivEXT_remap_index 350
-#define GetRenderbufferParameterivEXT_remap_index 351
-#define IsFramebufferEXT_remap_index 352
-#define IsRenderbufferEXT_remap_index 353
-#define RenderbufferStorageEXT_remap_index 354
-#define BlitFramebufferEXT_remap_index 355
-#define FramebufferTextureLayerEXT_remap_index 356
-#define StencilFuncSeparateATI_remap_index 357
-#define ProgramEnvParameters4fvEXT_remap_index 358
-#define ProgramLocalParameters4fvEXT_remap_index 359
-#define GetQueryObjecti64vEXT_remap_index 360
-#define GetQueryObjectui64vEXT_remap_index 361
+#define DrawArraysInstancedARB_remap_index 153
+#define DrawElementsInstancedARB_remap_index 154
+#define VertexAttribDivisorARB_remap_index 155
+#define PolygonOffsetEXT_remap_index 156
+#define GetPixelTexGenParameterfvSGIS_remap_index 157
+#define GetPixelTexGenParameterivSGIS_remap_index 158
+#define PixelTexGenParameterfSGIS_remap_index 159
+#define PixelTexGenParameterfvSGIS_remap_index 160
+#define PixelTexGenParameteriSGIS_remap_index 161
+#define PixelTexGenParameterivSGIS_remap_index 162
+#define SampleMaskSGIS_remap_index 163
+#define SamplePatternSGIS_remap_index 164
+#define ColorPointerEXT_remap_index 165
+#define EdgeFlagPointerEXT_remap_index 166
+#define IndexPointerEXT_remap_index 167
+#define NormalPointerEXT_remap_index 168
+#define TexCoordPointerEXT_remap_index 169
+#define VertexPointerEXT_remap_index 170
+#define PointParameterfEXT_remap_index 171
+#define PointParameterfvEXT_remap_index 172
+#define LockArraysEXT_remap_index 173
+#define UnlockArraysEXT_remap_index 174
+#define CullParameterdvEXT_remap_index 175
+#define CullParameterfvEXT_remap_index 176
+#define SecondaryColor3bEXT_remap_index 177
+#define SecondaryColor3bvEXT_remap_index 178
+#define SecondaryColor3dEXT_remap_index 179
+#define SecondaryColor3dvEXT_remap_index 180
+#define SecondaryColor3fEXT_remap_index 181
+#define SecondaryColor3fvEXT_remap_index 182
+#define SecondaryColor3iEXT_remap_index 183
+#define SecondaryColor3ivEXT_remap_index 184
+#define SecondaryColor3sEXT_remap_index 185
+#define SecondaryColor3svEXT_remap_index 186
+#define SecondaryColor3ubEXT_remap_index 187
+#define SecondaryColor3ubvEXT_remap_index 188
+#define SecondaryColor3uiEXT_remap_index 189
+#define SecondaryColor3uivEXT_remap_index 190
+#define SecondaryColor3usEXT_remap_index 191
+#define SecondaryColor3usvEXT_remap_index 192
+#define SecondaryColorPointerEXT_remap_index 193
+#define MultiDrawArraysEXT_remap_index 194
+#define MultiDrawElementsEXT_remap_index 195
+#define FogCoordPointerEXT_remap_index 196
+#define FogCoorddEXT_remap_index 197
+#define FogCoorddvEXT_remap_index 198
+#define FogCoordfEXT_remap_index 199
+#define FogCoordfvEXT_remap_index 200
+#define PixelTexGenSGIX_remap_index 201
+#define BlendFuncSeparateEXT_remap_index 202
+#define FlushVertexArrayRangeNV_remap_index 203
+#define VertexArrayRangeNV_remap_index 204
+#define CombinerInputNV_remap_index 205
+#define CombinerOutputNV_remap_index 206
+#define CombinerParameterfNV_remap_index 207
+#define CombinerParameterfvNV_remap_index 208
+#define CombinerParameteriNV_remap_index 209
+#define CombinerParameterivNV_remap_index 210
+#define FinalCombinerInputNV_remap_index 211
+#define GetCombinerInputParameterfvNV_remap_index 212
+#define GetCombinerInputParameterivNV_remap_index 213
+#define GetCombinerOutputParameterfvNV_remap_index 214
+#define GetCombinerOutputParameterivNV_remap_index 215
+#define GetFinalCombinerInputParameterfvNV_remap_index 216
+#define GetFinalCombinerInputParameterivNV_remap_index 217
+#define ResizeBuffersMESA_remap_index 218
+#define WindowPos2dMESA_remap_index 219
+#define WindowPos2dvMESA_remap_index 220
+#define WindowPos2fMESA_remap_index 221
+#define WindowPos2fvMESA_remap_index 222
+#define WindowPos2iMESA_remap_index 223
+#define WindowPos2ivMESA_remap_index 224
+#define WindowPos2sMESA_remap_index 225
+#define WindowPos2svMESA_remap_index 226
+#define WindowPos3dMESA_remap_index 227
+#define WindowPos3dvMESA_remap_index 228
+#define WindowPos3fMESA_remap_index 229
+#define WindowPos3fvMESA_remap_index 230
+#define WindowPos3iMESA_remap_index 231
+#define WindowPos3ivMESA_remap_index 232
+#define WindowPos3sMESA_remap_index 233
+#define WindowPos3svMESA_remap_index 234
+#define WindowPos4dMESA_remap_index 235
+#define WindowPos4dvMESA_remap_index 236
+#define WindowPos4fMESA_remap_index 237
+#define WindowPos4fvMESA_remap_index 238
+#define WindowPos4iMESA_remap_index 239
+#define WindowPos4ivMESA_remap_index 240
+#define WindowPos4sMESA_remap_index 241
+#define WindowPos4svMESA_remap_index 242
+#define MultiModeDrawArraysIBM_remap_index 243
+#define MultiModeDrawElementsIBM_remap_index 244
+#define DeleteFencesNV_remap_index 245
+#define FinishFenceNV_remap_index 246
+#define GenFencesNV_remap_index 247
+#define GetFenceivNV_remap_index 248
+#define IsFenceNV_remap_index 249
+#define SetFenceNV_remap_index 250
+#define TestFenceNV_remap_index 251
+#define AreProgramsResidentNV_remap_index 252
+#define BindProgramNV_remap_index 253
+#define DeleteProgramsNV_remap_index 254
+#define ExecuteProgramNV_remap_index 255
+#define GenProgramsNV_remap_index 256
+#define GetProgramParameterdvNV_remap_index 257
+#define GetProgramParameterfvNV_remap_index 258
+#define GetProgramStringNV_remap_index 259
+#define GetProgramivNV_remap_index 260
+#define GetTrackMatrixivNV_remap_index 261
+#define GetVertexAttribPointervNV_remap_index 262
+#define GetVertexAttribdvNV_remap_index 263
+#define GetVertexAttribfvNV_remap_index 264
+#define GetVertexAttribivNV_remap_index 265
+#define IsProgramNV_remap_index 266
+#define LoadProgramNV_remap_index 267
+#define ProgramParameters4dvNV_remap_index 268
+#define ProgramParameters4fvNV_remap_index 269
+#define RequestResidentProgramsNV_remap_index 270
+#define TrackMatrixNV_remap_index 271
+#define VertexAttrib1dNV_remap_index 272
+#define VertexAttrib1dvNV_remap_index 273
+#define VertexAttrib1fNV_remap_index 274
+#define VertexAttrib1fvNV_remap_index 275
+#define VertexAttrib1sNV_remap_index 276
+#define VertexAttrib1svNV_remap_index 277
+#define VertexAttrib2dNV_remap_index 278
+#define VertexAttrib2dvNV_remap_index 279
+#define VertexAttrib2fNV_remap_index 280
+#define VertexAttrib2fvNV_remap_index 281
+#define VertexAttrib2sNV_remap_index 282
+#define VertexAttrib2svNV_remap_index 283
+#define VertexAttrib3dNV_remap_index 284
+#define VertexAttrib3dvNV_remap_index 285
+#define VertexAttrib3fNV_remap_index 286
+#define VertexAttrib3fvNV_remap_index 287
+#define VertexAttrib3sNV_remap_index 288
+#define VertexAttrib3svNV_remap_index 289
+#define VertexAttrib4dNV_remap_index 290
+#define VertexAttrib4dvNV_remap_index 291
+#define VertexAttrib4fNV_remap_index 292
+#define VertexAttrib4fvNV_remap_index 293
+#define VertexAttrib4sNV_remap_index 294
+#define VertexAttrib4svNV_remap_index 295
+#define VertexAttrib4ubNV_remap_index 296
+#define VertexAttrib4ubvNV_remap_index 297
+#define VertexAttribPointerNV_remap_index 298
+#define VertexAttribs1dvNV_remap_index 299
+#define VertexAttribs1fvNV_remap_index 300
+#define VertexAttribs1svNV_remap_index 301
+#define VertexAttribs2dvNV_remap_index 302
+#define VertexAttribs2fvNV_remap_index 303
+#define VertexAttribs2svNV_remap_index 304
+#define VertexAttribs3dvNV_remap_index 305
+#define VertexAttribs3fvNV_remap_index 306
+#define VertexAttribs3svNV_remap_index 307
+#define VertexAttribs4dvNV_remap_index 308
+#define VertexAttribs4fvNV_remap_index 309
+#define VertexAttribs4svNV_remap_index 310
+#define VertexAttribs4ubvNV_remap_index 311
+#define AlphaFragmentOp1ATI_remap_index 312
+#define AlphaFragmentOp2ATI_remap_index 313
+#define AlphaFragmentOp3ATI_remap_index 314
+#define BeginFragmentShaderATI_remap_index 315
+#define BindFragmentShaderATI_remap_index 316
+#define ColorFragmentOp1ATI_remap_index 317
+#define ColorFragmentOp2ATI_remap_index 318
+#define ColorFragmentOp3ATI_remap_index 319
+#define DeleteFragmentShaderATI_remap_index 320
+#define EndFragmentShaderATI_remap_index 321
+#define GenFragmentShadersATI_remap_index 322
+#define PassTexCoordATI_remap_index 323
+#define SampleMapATI_remap_index 324
+#define SetFragmentShaderConstantATI_remap_index 325
+#define PointParameteriNV_remap_index 326
+#define PointParameterivNV_remap_index 327
+#define ActiveStencilFaceEXT_remap_index 328
+#define BindVertexArrayAPPLE_remap_index 329
+#define DeleteVertexArraysAPPLE_remap_index 330
+#define GenVertexArraysAPPLE_remap_index 331
+#define IsVertexArrayAPPLE_remap_index 332
+#define GetProgramNamedParameterdvNV_remap_index 333
+#define GetProgramNamedParameterfvNV_remap_index 334
+#define ProgramNamedParameter4dNV_remap_index 335
+#define ProgramNamedParameter4dvNV_remap_index 336
+#define ProgramNamedParameter4fNV_remap_index 337
+#define ProgramNamedParameter4fvNV_remap_index 338
+#define DepthBoundsEXT_remap_index 339
+#define BlendEquationSeparateEXT_remap_index 340
+#define BindFramebufferEXT_remap_index 341
+#define BindRenderbufferEXT_remap_index 342
+#define CheckFramebufferStatusEXT_remap_index 343
+#define DeleteFramebuffersEXT_remap_index 344
+#define DeleteRenderbuffersEXT_remap_index 345
+#define FramebufferRenderbufferEXT_remap_index 346
+#define FramebufferTexture1DEXT_remap_index 347
+#define FramebufferTexture2DEXT_remap_index 348
+#define FramebufferTexture3DEXT_remap_index 349
+#define GenFramebuffersEXT_remap_index 350
+#define GenRenderbuffersEXT_remap_index 351
+#define GenerateMipmapEXT_remap_index 352
+#define GetFramebufferAttachmentParameterivEXT_remap_index 353
+#define GetRenderbufferParameterivEXT_remap_index 354
+#define IsFramebufferEXT_remap_index 355
+#define IsRenderbufferEXT_remap_index 356
+#define RenderbufferStorageEXT_remap_index 357
+#define BlitFramebufferEXT_remap_index 358
+#define FramebufferTextureLayerEXT_remap_index 359
+#define StencilFuncSeparateATI_remap_index 360
+#define ProgramEnvParameters4fvEXT_remap_index 361
+#define ProgramLocalParameters4fvEXT_remap_index 362
+#define GetQueryObjecti64vEXT_remap_index 363
+#define GetQueryObjectui64vEXT_remap_index 364
 
 #define CALL_AttachShader(disp, parameters) CALL_by_offset(disp, (void (GLAPIENTRYP)(GLuint, GLuint)), driDispatchRemapTable[AttachShader_remap_index], parameters)
 #define GET_AttachShader(disp) GET_by_offset(disp, driDispatchRemapTable[AttachShader_remap_index])
@@ -3199,6 +3211,15 @@ extern int driDispatchRemapTable[ driDispatchRemapTable_size ];
 #define CALL_DrawBuffersARB(disp, parameters) CALL_by_offset(disp, (void (GLAPIENTRYP)(GLsizei, const GLenum *)), driDispatchRemapTable[DrawBuffersARB_remap_index], parameters)
 #define GET_DrawBuffersARB(disp) GET_by_offset(disp, driDispatchRemapTable[DrawBuffersARB_remap_index])
 #define SET_DrawBuffersARB(disp, fn) SET_by_offset(disp, driDispatchRemapTable[DrawBuffersARB_remap_index], fn)
+#define CALL_DrawArraysInstancedARB(disp, parameters) CALL_by_offset(disp, (void (GLAPIENTRYP)(GLenum, GLint, GLsizei, GLsizei)), driDispatchRemapTable[DrawArraysInstancedARB_remap_index], parameters)
+#define GET_DrawArraysInstancedARB(disp) GET_by_offset(disp, driDispatchRemapTable[DrawArraysInstancedARB_remap_index])
+#define SET_DrawArraysInstancedARB(disp, fn) SET_by_offset(disp, driDispatchRemapTable[DrawArraysInstancedARB_remap_index], fn)
+#define CALL_DrawElementsInstancedARB(disp, parameters) CALL_by_offset(disp, (void (GLAPIENTRYP)(GLenum, GLsizei, GLenum, const GLvoid *, GLsizei)), driDispatchRemapTable[DrawElementsInstancedARB_remap_index], parameters)
+#define GET_DrawElementsInstancedARB(disp) GET_by_offset(disp, driDispatchRemapTable[DrawElementsInstancedARB_remap_index])
+#define SET_DrawElementsInstancedARB(disp, fn) SET_by_offset(disp, driDispatchRemapTable[DrawElementsInstancedARB_remap_index], fn)
+#define CALL_VertexAttribDivisorARB(disp, parameters) CALL_by_offset(disp, (void (GLAPIENTRYP)(GLuint, GLuint)), driDispatchRemapTable[VertexAttribDivisorARB_remap_index], parameters)
+#define GET_VertexAttribDivisorARB(disp) GET_by_offset(disp, driDispatchRemapTable[VertexAttribDivisorARB_remap_index])
+#define SET_VertexAttribDivisorARB(disp, fn) SET_by_offset(disp, driDispatchRemapTable[VertexAttribDivisorARB_remap_index], fn)
 #define CALL_PolygonOffsetEXT(disp, parameters) CALL_by_offset(disp, (void (GLAPIENTRYP)(GLfloat, GLfloat)), driDispatchRemapTable[PolygonOffsetEXT_remap_index], parameters)
 #define GET_PolygonOffsetEXT(disp) GET_by_offset(disp, driDispatchRemapTable[PolygonOffsetEXT_remap_index])
 #define SET_PolygonOffsetEXT(disp, fn) SET_by_offset(disp, driDispatchRemapTable[PolygonOffsetEXT_remap_index], fn)
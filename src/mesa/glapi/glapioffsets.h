@@ -593,216 +593,219 @@
 #define _gloffset_GetActiveAttribARB 558
 #define _gloffset_GetAttribLocationARB 559
 #define _gloffset_DrawBuffersARB 560
-#define _gloffset_PolygonOffsetEXT 561
-#define _gloffset_GetPixelTexGenParameterfvSGIS 562
-#define _gloffset_GetPixelTexGenParameterivSGIS 563
-#define _gloffset_PixelTexGenParameterfSGIS 564
-#define _gloffset_PixelTexGenParameterfvSGIS 565
-#define _gloffset_PixelTexGenParameteriSGIS 566
-#define _gloffset_PixelTexGenParameterivSGIS 567
-#define _gloffset_SampleMaskSGIS 568
-#define _gloffset_SamplePatternSGIS 569
-#define _gloffset_ColorPointerEXT 570
-#define _gloffset_EdgeFlagPointerEXT 571
-#define _gloffset_IndexPointerEXT 572
-#define _gloffset_NormalPointerEXT 573
-#define _gloffset_TexCoordPointerEXT 574
-#define _gloffset_VertexPointerEXT 575
-#define _gloffset_PointParameterfEXT 576
-#define _gloffset_PointParameterfvEXT 577
-#define _gloffset_LockArraysEXT 578
-#define _gloffset_UnlockArraysEXT 579
-#define _gloffset_CullParameterdvEXT 580
-#define _gloffset_CullParameterfvEXT 581
-#define _gloffset_SecondaryColor3bEXT 582
-#define _gloffset_SecondaryColor3bvEXT 583
-#define _gloffset_SecondaryColor3dEXT 584
-#define _gloffset_SecondaryColor3dvEXT 585
-#define _gloffset_SecondaryColor3fEXT 586
-#define _gloffset_SecondaryColor3fvEXT 587
-#define _gloffset_SecondaryColor3iEXT 588
-#define _gloffset_SecondaryColor3ivEXT 589
-#define _gloffset_SecondaryColor3sEXT 590
-#define _gloffset_SecondaryColor3svEXT 591
-#define _gloffset_SecondaryColor3ubEXT 592
-#define _gloffset_SecondaryColor3ubvEXT 593
-#define _gloffset_SecondaryColor3uiEXT 594
-#define _gloffset_SecondaryColor3uivEXT 595
-#define _gloffset_SecondaryColor3usEXT 596
-#define _gloffset_SecondaryColor3usvEXT 597
-#define _gloffset_SecondaryColorPointerEXT 598
-#define _gloffset_MultiDrawArraysEXT 599
-#define _gloffset_MultiDrawElementsEXT 600
-#define _gloffset_FogCoordPointerEXT 601
-#define _gloffset_FogCoorddEXT 602
-#define _gloffset_FogCoorddvEXT 603
-#define _gloffset_FogCoordfEXT 604
-#define _gloffset_FogCoordfvEXT 605
-#define _gloffset_PixelTexGenSGIX 606
-#define _gloffset_BlendFuncSeparateEXT 607
-#define _gloffset_FlushVertexArrayRangeNV 608
-#define _gloffset_VertexArrayRangeNV 609
-#define _gloffset_CombinerInputNV 610
-#define _gloffset_CombinerOutputNV 611
-#define _gloffset_CombinerParameterfNV 612
-#define _gloffset_CombinerParameterfvNV 613
-#define _gloffset_CombinerParameteriNV 614
-#define _gloffset_CombinerParameterivNV 615
-#define _gloffset_FinalCombinerInputNV 616
-#define _gloffset_GetCombinerInputParameterfvNV 617
-#define _gloffset_GetCombinerInputParameterivNV 618
-#define _gloffset_GetCombinerOutputParameterfvNV 619
-#define _gloffset_GetCombinerOutputParameterivNV 620
-#define _gloffset_GetFinalCombinerInputParameterfvNV 621
-#define _gloffset_GetFinalCombinerInputParameterivNV 622
-#define _gloffset_ResizeBuffersMESA 623
-#define _gloffset_WindowPos2dMESA 624
-#define _gloffset_WindowPos2dvMESA 625
-#define _gloffset_WindowPos2fMESA 626
-#define _gloffset_WindowPos2fvMESA 627
-#define _gloffset_WindowPos2iMESA 628
-#define _gloffset_WindowPos2ivMESA 629
-#define _gloffset_WindowPos2sMESA 630
-#define _gloffset_WindowPos2svMESA 631
-#define _gloffset_WindowPos3dMESA 632
-#define _gloffset_WindowPos3dvMESA 633
-#define _gloffset_WindowPos3fMESA 634
-#define _gloffset_WindowPos3fvMESA 635
-#define _gloffset_WindowPos3iMESA 636
-#define _gloffset_WindowPos3ivMESA 637
-#define _gloffset_WindowPos3sMESA 638
-#define _gloffset_WindowPos3svMESA 639
-#define _gloffset_WindowPos4dMESA 640
-#define _gloffset_WindowPos4dvMESA 641
-#define _gloffset_WindowPos4fMESA 642
-#define _gloffset_WindowPos4fvMESA 643
-#define _gloffset_WindowPos4iMESA 644
-#define _gloffset_WindowPos4ivMESA 645
-#define _gloffset_WindowPos4sMESA 646
-#define _gloffset_WindowPos4svMESA 647
-#define _gloffset_MultiModeDrawArraysIBM 648
-#define _gloffset_MultiModeDrawElementsIBM 649
-#define _gloffset_DeleteFencesNV 650
-#define _gloffset_FinishFenceNV 651
-#define _gloffset_GenFencesNV 652
-#define _gloffset_GetFenceivNV 653
-#define _gloffset_IsFenceNV 654
-#define _gloffset_SetFenceNV 655
-#define _gloffset_TestFenceNV 656
-#define _gloffset_AreProgramsResidentNV 657
-#define _gloffset_BindProgramNV 658
-#define _gloffset_DeleteProgramsNV 659
-#define _gloffset_ExecuteProgramNV 660
-#define _gloffset_GenProgramsNV 661
-#define _gloffset_GetProgramParameterdvNV 662
-#define _gloffset_GetProgramParameterfvNV 663
-#define _gloffset_GetProgramStringNV 664
-#define _gloffset_GetProgramivNV 665
-#define _gloffset_GetTrackMatrixivNV 666
-#define _gloffset_GetVertexAttribPointervNV 667
-#define _gloffset_GetVertexAttribdvNV 668
-#define _gloffset_GetVertexAttribfvNV 669
-#define _gloffset_GetVertexAttribivNV 670
-#define _gloffset_IsProgramNV 671
-#define _gloffset_LoadProgramNV 672
-#define _gloffset_ProgramParameters4dvNV 673
-#define _gloffset_ProgramParameters4fvNV 674
-#define _gloffset_RequestResidentProgramsNV 675
-#define _gloffset_TrackMatrixNV 676
-#define _gloffset_VertexAttrib1dNV 677
-#define _gloffset_VertexAttrib1dvNV 678
-#define _gloffset_VertexAttrib1fNV 679
-#define _gloffset_VertexAttrib1fvNV 680
-#define _gloffset_VertexAttrib1sNV 681
-#define _gloffset_VertexAttrib1svNV 682
-#define _gloffset_VertexAttrib2dNV 683
-#define _gloffset_VertexAttrib2dvNV 684
-#define _gloffset_VertexAttrib2fNV 685
-#define _gloffset_VertexAttrib2fvNV 686
-#define _gloffset_VertexAttrib2sNV 687
-#define _gloffset_VertexAttrib2svNV 688
-#define _gloffset_VertexAttrib3dNV 689
-#define _gloffset_VertexAttrib3dvNV 690
-#define _gloffset_VertexAttrib3fNV 691
-#define _gloffset_VertexAttrib3fvNV 692
-#define _gloffset_VertexAttrib3sNV 693
-#define _gloffset_VertexAttrib3svNV 694
-#define _gloffset_VertexAttrib4dNV 695
-#define _gloffset_VertexAttrib4dvNV 696
-#define _gloffset_VertexAttrib4fNV 697
-#define _gloffset_VertexAttrib4fvNV 698
-#define _gloffset_VertexAttrib4sNV 699
-#define _gloffset_VertexAttrib4svNV 700
-#define _gloffset_VertexAttrib4ubNV 701
-#define _gloffset_VertexAttrib4ubvNV 702
-#define _gloffset_VertexAttribPointerNV 703
-#define _gloffset_VertexAttribs1dvNV 704
-#define _gloffset_VertexAttribs1fvNV 705
-#define _gloffset_VertexAttribs1svNV 706
-#define _gloffset_VertexAttribs2dvNV 707
-#define _gloffset_VertexAttribs2fvNV 708
-#define _gloffset_VertexAttribs2svNV 709
-#define _gloffset_VertexAttribs3dvNV 710
-#define _gloffset_VertexAttribs3fvNV 711
-#define _gloffset_VertexAttribs3svNV 712
-#define _gloffset_VertexAttribs4dvNV 713
-#define _gloffset_VertexAttribs4fvNV 714
-#define _gloffset_VertexAttribs4svNV 715
-#define _gloffset_VertexAttribs4ubvNV 716
-#define _gloffset_AlphaFragmentOp1ATI 717
-#define _gloffset_AlphaFragmentOp2ATI 718
-#define _gloffset_AlphaFragmentOp3ATI 719
-#define _gloffset_BeginFragmentShaderATI 720
-#define _gloffset_BindFragmentShaderATI 721
-#define _gloffset_ColorFragmentOp1ATI 722
-#define _gloffset_ColorFragmentOp2ATI 723
-#define _gloffset_ColorFragmentOp3ATI 724
-#define _gloffset_DeleteFragmentShaderATI 725
-#define _gloffset_EndFragmentShaderATI 726
-#define _gloffset_GenFragmentShadersATI 727
-#define _gloffset_PassTexCoordATI 728
-#define _gloffset_SampleMapATI 729
-#define _gloffset_SetFragmentShaderConstantATI 730
-#define _gloffset_PointParameteriNV 731
-#define _gloffset_PointParameterivNV 732
-#define _gloffset_ActiveStencilFaceEXT 733
-#define _gloffset_BindVertexArrayAPPLE 734
-#define _gloffset_DeleteVertexArraysAPPLE 735
-#define _gloffset_GenVertexArraysAPPLE 736
-#define _gloffset_IsVertexArrayAPPLE 737
-#define _gloffset_GetProgramNamedParameterdvNV 738
-#define _gloffset_GetProgramNamedParameterfvNV 739
-#define _gloffset_ProgramNamedParameter4dNV 740
-#define _gloffset_ProgramNamedParameter4dvNV 741
-#define _gloffset_ProgramNamedParameter4fNV 742
-#define _gloffset_ProgramNamedParameter4fvNV 743
-#define _gloffset_DepthBoundsEXT 744
-#define _gloffset_BlendEquationSeparateEXT 745
-#define _gloffset_BindFramebufferEXT 746
-#define _gloffset_BindRenderbufferEXT 747
-#define _gloffset_CheckFramebufferStatusEXT 748
-#define _gloffset_DeleteFramebuffersEXT 749
-#define _gloffset_DeleteRenderbuffersEXT 750
-#define _gloffset_FramebufferRenderbufferEXT 751
-#define _gloffset_FramebufferTexture1DEXT 752
-#define _gloffset_FramebufferTexture2DEXT 753
-#define _gloffset_FramebufferTexture3DEXT 754
-#define _gloffset_GenFramebuffersEXT 755
-#define _gloffset_GenRenderbuffersEXT 756
-#define _gloffset_GenerateMipmapEXT 757
-#define _gloffset_GetFramebufferAttachmentParameterivEXT 758
-#define _gloffset_GetRenderbufferParameterivEXT 759
-#define _gloffset_IsFramebufferEXT 760
-#define _gloffset_IsRenderbufferEXT 761
-#define _gloffset_RenderbufferStorageEXT 762
-#define _gloffset_BlitFramebufferEXT 763
-#define _gloffset_FramebufferTextureLayerEXT 764
-#define _gloffset_StencilFuncSeparateATI 765
-#define _gloffset_ProgramEnvParameters4fvEXT 766
-#define _gloffset_ProgramLocalParameters4fvEXT 767
-#define _gloffset_GetQueryObjecti64vEXT 768
-#define _gloffset_GetQueryObjectui64vEXT 769
-#define _gloffset_FIRST_DYNAMIC 770
+#define _gloffset_DrawArraysInstancedARB 561
+#define _gloffset_DrawElementsInstancedARB 562
+#define _gloffset_VertexAttribDivisorARB 563
+#define _gloffset_PolygonOffsetEXT 564
+#define _gloffset_GetPixelTexGenParameterfvSGIS 565
+#define _gloffset_GetPixelTexGenParameterivSGIS 566
+#define _gloffset_PixelTexGenParameterfSGIS 567
+#define _gloffset_PixelTexGenParameterfvSGIS 568
+#define _gloffset_PixelTexGenParameteriSGIS 569
+#define _gloffset_PixelTexGenParameterivSGIS 570
+#define _gloffset_SampleMaskSGIS 571
+#define _gloffset_SamplePatternSGIS 572
+#define _gloffset_ColorPointerEXT 573
+#define _gloffset_EdgeFlagPointerEXT 574
+#define _gloffset_IndexPointerEXT 575
+#define _gloffset_NormalPointerEXT 576
+#define _gloffset_TexCoordPointerEXT 577
+#define _gloffset_VertexPointerEXT 578
+#define _gloffset_PointParameterfEXT 579
+#define _gloffset_PointParameterfvEXT 580
+#define _gloffset_LockArraysEXT 581
+#define _gloffset_UnlockArraysEXT 582
+#define _gloffset_CullParameterdvEXT 583
+#define _gloffset_CullParameterfvEXT 584
+#define _gloffset_SecondaryColor3bEXT 585
+#define _gloffset_SecondaryColor3bvEXT 586
+#define _gloffset_SecondaryColor3dEXT 587
+#define _gloffset_SecondaryColor3dvEXT 588
+#define _gloffset_SecondaryColor3fEXT 589
+#define _gloffset_SecondaryColor3fvEXT 590
+#define _gloffset_SecondaryColor3iEXT 591
+#define _gloffset_SecondaryColor3ivEXT 592
+#define _gloffset_SecondaryColor3sEXT 593
+#define _gloffset_SecondaryColor3svEXT 594
+#define _gloffset_SecondaryColor3ubEXT 595
+#define _gloffset_SecondaryColor3ubvEXT 596
+#define _gloffset_SecondaryColor3uiEXT 597
+#define _gloffset_SecondaryColor3uivEXT 598
+#define _gloffset_SecondaryColor3usEXT 599
+#define _gloffset_SecondaryColor3usvEXT 600
+#define _gloffset_SecondaryColorPointerEXT 601
+#define _gloffset_MultiDrawArraysEXT 602
+#define _gloffset_MultiDrawElementsEXT 603
+#define _gloffset_FogCoordPointerEXT 604
+#define _gloffset_FogCoorddEXT 605
+#define _gloffset_FogCoorddvEXT 606
+#define _gloffset_FogCoordfEXT 607
+#define _gloffset_FogCoordfvEXT 608
+#define _gloffset_PixelTexGenSGIX 609
+#define _gloffset_BlendFuncSeparateEXT 610
+#define _gloffset_FlushVertexArrayRangeNV 611
+#define _gloffset_VertexArrayRangeNV 612
+#define _gloffset_CombinerInputNV 613
+#define _gloffset_CombinerOutputNV 614
+#define _gloffset_CombinerParameterfNV 615
+#define _gloffset_CombinerParameterfvNV 616
+#define _gloffset_CombinerParameteriNV 617
+#define _gloffset_CombinerParameterivNV 618
+#define _gloffset_FinalCombinerInputNV 619
+#define _gloffset_GetCombinerInputParameterfvNV 620
+#define _gloffset_GetCombinerInputParameterivNV 621
+#define _gloffset_GetCombinerOutputParameterfvNV 622
+#define _gloffset_GetCombinerOutputParameterivNV 623
+#define _gloffset_GetFinalCombinerInputParameterfvNV 624
+#define _gloffset_GetFinalCombinerInputParameterivNV 625
+#define _gloffset_ResizeBuffersMESA 626
+#define _gloffset_WindowPos2dMESA 627
+#define _gloffset_WindowPos2dvMESA 628
+#define _gloffset_WindowPos2fMESA 629
+#define _gloffset_WindowPos2fvMESA 630
+#define _gloffset_WindowPos2iMESA 631
+#define _gloffset_WindowPos2ivMESA 632
+#define _gloffset_WindowPos2sMESA 633
+#define _gloffset_WindowPos2svMESA 634
+#define _gloffset_WindowPos3dMESA 635
+#define _gloffset_WindowPos3dvMESA 636
+#define _gloffset_WindowPos3fMESA 637
+#define _gloffset_WindowPos3fvMESA 638
+#define _gloffset_WindowPos3iMESA 639
+#define _gloffset_WindowPos3ivMESA 640
+#define _gloffset_WindowPos3sMESA 641
+#define _gloffset_WindowPos3svMESA 642
+#define _gloffset_WindowPos4dMESA 643
+#define _gloffset_WindowPos4dvMESA 644
+#define _gloffset_WindowPos4fMESA 645
+#define _gloffset_WindowPos4fvMESA 646
+#define _gloffset_WindowPos4iMESA 647
+#define _gloffset_WindowPos4ivMESA 648
+#define _gloffset_WindowPos4sMESA 649
+#define _gloffset_WindowPos4svMESA 650
+#define _gloffset_MultiModeDrawArraysIBM 651
+#define _gloffset_MultiModeDrawElementsIBM 652
+#define _gloffset_DeleteFencesNV 653
+#define _gloffset_FinishFenceNV 654
+#define _gloffset_GenFencesNV 655
+#define _gloffset_GetFenceivNV 656
+#define _gloffset_IsFenceNV 657
+#define _gloffset_SetFenceNV 658
+#define _gloffset_TestFenceNV 659
+#define _gloffset_AreProgramsResidentNV 660
+#define _gloffset_BindProgramNV 661
+#define _gloffset_DeleteProgramsNV 662
+#define _gloffset_ExecuteProgramNV 663
+#define _gloffset_GenProgramsNV 664
+#define _gloffset_GetProgramParameterdvNV 665
+#define _gloffset_GetProgramParameterfvNV 666
+#define _gloffset_GetProgramStringNV 667
+#define _gloffset_GetProgramivNV 668
+#define _gloffset_GetTrackMatrixivNV 669
+#define _gloffset_GetVertexAttribPointervNV 670
+#define _gloffset_GetVertexAttribdvNV 671
+#define _gloffset_GetVertexAttribfvNV 672
+#define _gloffset_GetVertexAttribivNV 673
+#define _gloffset_IsProgramNV 674
+#define _gloffset_LoadProgramNV 675
+#define _gloffset_ProgramParameters4dvNV 676
+#define _gloffset_ProgramParameters4fvNV 677
+#define _gloffset_RequestResidentProgramsNV 678
+#define _gloffset_TrackMatrixNV 679
+#define _gloffset_VertexAttrib1dNV 680
+#define _gloffset_VertexAttrib1dvNV 681
+#define _gloffset_VertexAttrib1fNV 682
+#define _gloffset_VertexAttrib1fvNV 683
+#define _gloffset_VertexAttrib1sNV 684
+#define _gloffset_VertexAttrib1svNV 685
+#define _gloffset_VertexAttrib2dNV 686
+#define _gloffset_VertexAttrib2dvNV 687
+#define _gloffset_VertexAttrib2fNV 688
+#define _gloffset_VertexAttrib2fvNV 689
+#define _gloffset_VertexAttrib2sNV 690
+#define _gloffset_VertexAttrib2svNV 691
+#define _gloffset_VertexAttrib3dNV 692
+#define _gloffset_VertexAttrib3dvNV 693
+#define _gloffset_VertexAttrib3fNV 694
+#define _gloffset_VertexAttrib3fvNV 695
+#define _gloffset_VertexAttrib3sNV 696
+#define _gloffset_VertexAttrib3svNV 697
+#define _gloffset_VertexAttrib4dNV 698
+#define _gloffset_VertexAttrib4dvNV 699
+#define _gloffset_VertexAttrib4fNV 700
+#define _gloffset_VertexAttrib4fvNV 701
+#define _gloffset_VertexAttrib4sNV 702
+#define _gloffset_VertexAttrib4svNV 703
+#define _gloffset_VertexAttrib4ubNV 704
+#define _gloffset_VertexAttrib4ubvNV 705
+#define _gloffset_VertexAttribPointerNV 706
+#define _gloffset_VertexAttribs1dvNV 707
+#define _gloffset_VertexAttribs1fvNV 708
+#define _gloffset_VertexAttribs1svNV 709
+#define _gloffset_VertexAttribs2dvNV 710
+#define _gloffset_VertexAttribs2fvNV 711
+#define _gloffset_VertexAttribs2svNV 712
+#define _gloffset_VertexAttribs3dvNV 713
+#define _gloffset_VertexAttribs3fvNV 714
+#define _gloffset_VertexAttribs3svNV 715
+#define _gloffset_VertexAttribs4dvNV 716
+#define _gloffset_VertexAttribs4fvNV 717
+#define _gloffset_VertexAttribs4svNV 718
+#define _gloffset_VertexAttribs4ubvNV 719
+#define _gloffset_AlphaFragmentOp1ATI 720
+#define _gloffset_AlphaFragmentOp2ATI 721
+#define _gloffset_AlphaFragmentOp3ATI 722
+#define _gloffset_BeginFragmentShaderATI 723
+#define _gloffset_BindFragmentShaderATI 724
+#define _gloffset_ColorFragmentOp1ATI 725
+#define _gloffset_ColorFragmentOp2ATI 726
+#define _gloffset_ColorFragmentOp3ATI 727
+#define _gloffset_DeleteFragmentShaderATI 728
+#define _gloffset_EndFragmentShaderATI 729
+#define _gloffset_GenFragmentShadersATI 730
+#define _gloffset_PassTexCoordATI 731
+#define _gloffset_SampleMapATI 732
+#define _gloffset_SetFragmentShaderConstantATI 733
+#define _gloffset_PointParameteriNV 734
+#define _gloffset_PointParameterivNV 735
+#define _gloffset_ActiveStencilFaceEXT 736
+#define _gloffset_BindVertexArrayAPPLE 737
+#define _gloffset_DeleteVertexArraysAPPLE 738
+#define _gloffset_GenVertexArraysAPPLE 739
+#define _gloffset_IsVertexArrayAPPLE 740
+#define _gloffset_GetProgramNamedParameterdvNV 741
+#define _gloffset_GetProgramNamedParameterfvNV 742
+#define _gloffset_ProgramNamedParameter4dNV 743
+#define _gloffset_ProgramNamedParameter4dvNV 744
+#define _gloffset_ProgramNamedParameter4fNV 745
+#define _gloffset_ProgramNamedParameter4fvNV 746
+#define _gloffset_DepthBoundsEXT 747
+#define _gloffset_BlendEquationSeparateEXT 748
+#define _gloffset_BindFramebufferEXT 749
+#define _gloffset_BindRenderbufferEXT 750
+#define _gloffset_CheckFramebufferStatusEXT 751
+#define _gloffset_DeleteFramebuffersEXT 752
+#define _gloffset_DeleteRenderbuffersEXT 753
+#define _gloffset_FramebufferRenderbufferEXT 754
+#define _gloffset_FramebufferTexture1DEXT 755
+#define _gloffset_FramebufferTexture2DEXT 756
+#define _gloffset_FramebufferTexture3DEXT 757
+#define _gloffset_GenFramebuffersEXT 758
+#define _gloffset_GenRenderbuffersEXT 759
+#define _gloffset_GenerateMipmapEXT 760
+#define _gloffset_GetFramebufferAttachmentParameterivEXT 761
+#define _gloffset_GetRenderbufferParameterivEXT 762
+#define _gloffset_IsFramebufferEXT 763
+#define _gloffset_IsRenderbufferEXT 764
+#define _gloffset_RenderbufferStorageEXT 765
+#define _gloffset_BlitFramebufferEXT 766
+#define _gloffset_FramebufferTextureLayerEXT 767
+#define _gloffset_StencilFuncSeparateATI 768
+#define _gloffset_ProgramEnvParameters4fvEXT 769
+#define _gloffset_ProgramLocalParameters4fvEXT 770
+#define _gloffset_GetQueryObjecti64vEXT 771
+#define _gloffset_GetQueryObjectui64vEXT 772
+#define _gloffset_FIRST_DYNAMIC 773
 
 #else
 
@@ -959,6 +962,9 @@
 #define _gloffset_GetActiveAttribARB driDispatchRemapTable[GetActiveAttribARB_remap_index]
 #define _gloffset_GetAttribLocationARB driDispatchRemapTable[GetAttribLocationARB_remap_index]
 #define _gloffset_DrawBuffersARB driDispatchRemapTable[DrawBuffersARB_remap_index]
+#define _gloffset_DrawArraysInstancedARB driDispatchRemapTable[DrawArraysInstancedARB_remap_index]
+#define _gloffset_DrawElementsInstancedARB driDispatchRemapTable[DrawElementsInstancedARB_remap_index]
+#define _gloffset_VertexAttribDivisorARB driDispatchRemapTable[VertexAttribDivisorARB_remap_index]
 #define _gloffset_PolygonOffsetEXT driDispatchRemapTable[PolygonOffsetEXT_remap_index]
 #define _gloffset_GetPixelTexGenParameterfvSGIS driDispatchRemapTable[GetPixelTexGenParameterfvSGIS_remap_index]
 #define _gloffset_GetPixelTexGenParameterivSGIS driDispatchRemapTable[GetPixelTexGenParameterivSGIS_remap_index]
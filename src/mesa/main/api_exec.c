@@ -772,6 +772,11 @@ _mesa_init_exec_table(struct _glapi_table *exec)
    SET_DrawBuffersARB(exec, _mesa_DrawBuffersARB);
 #endif
 
+   /* ARB 49. GL_ARB_instanced_arrays */
+#if FEATURE_ARB_vertex_program
+   SET_VertexAttribDivisorARB(exec, _mesa_VertexAttribDivisorARB);
+#endif
+
 #if FEATURE_ARB_shader_objects
    SET_DeleteObjectARB(exec, _mesa_DeleteObjectARB);
    SET_GetHandleARB(exec, _mesa_GetHandleARB);
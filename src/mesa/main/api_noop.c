@@ -772,6 +772,59 @@ _mesa_noop_DrawRangeElements(GLenum mode,
        CALL_DrawElements(GET_DISPATCH(), (mode, count, type, indices));
 }
 
+
+static void GLAPIENTRY
+_mesa_noop_MultiDrawArraysEXT(GLenum mode, GLint *first,
+                              GLsizei *count, GLsizei primcount)
+{
+   GLint i;
+
+   for (i = 0; i < primcount; i++) {
+      if (count[i] > 0)
+         CALL_DrawArrays(GET_DISPATCH(), (mode, first[i], count[i]));
+   }
+}
+
+
+static void GLAPIENTRY
+_mesa_noop_MultiDrawElementsEXT(GLenum mode, const GLsizei *count,
+                                GLenum type, const GLvoid **indices,
+                                GLsizei primcount)
+{
+   GLint i;
+
+   for (i = 0; i < primcount; i++) {
+      if (count[i] > 0)
+         CALL_DrawElements(GET_DISPATCH(), (mode, count[i], type, indices[i]));
+   }
+}
+
+
+/*
+ * Instanced drawing: these ignore vertex attribute divisors and the
+ * instance ID, and just draw the same vertices primcount times.
+ */
+static void GLAPIENTRY
+_mesa_noop_DrawArraysInstancedARB(GLenum mode, GLint first,
+                                  GLsizei count, GLsizei primcount)
+{
+   GLint i;
+
+   for (i = 0; i < primcount; i++)
+      CALL_DrawArrays(GET_DISPATCH(), (mode, first, count));
+}
+
+
+static void GLAPIENTRY
+_mesa_noop_DrawElementsInstancedARB(GLenum mode, GLsizei count, GLenum type,
+                                    const GLvoid *indices, GLsizei primcount)
+{
+   GLint i;
+
+   for (i = 0; i < primcount; i++)
+      CALL_DrawElements(GET_DISPATCH(), (mode, count, type, indices));
+}
+
 /*
  * Eval Mesh
  */
@@ -980,6 +1033,10 @@ _mesa_noop_vtxfmt_init( GLvertexformat *vfmt )
    vfmt->DrawArrays = _mesa_noop_DrawArrays;
    vfmt->DrawElements = _mesa_noop_DrawElements;
    vfmt->DrawRangeElements = _mesa_noop_DrawRangeElements;
+   vfmt->MultiDrawArraysEXT = _mesa_noop_MultiDrawArraysEXT;
+   vfmt->MultiDrawElementsEXT = _mesa_noop_MultiDrawElementsEXT;
+   vfmt->DrawArraysInstancedARB = _mesa_noop_DrawArraysInstancedARB;
+   vfmt->DrawElementsInstancedARB = _mesa_noop_DrawElementsInstancedARB;
    vfmt->EvalMesh1 = _mesa_noop_EvalMesh1;
    vfmt->EvalMesh2 = _mesa_noop_EvalMesh2;
 }
@@ -281,3 +281,38 @@ _mesa_validate_DrawArrays(GLcontext *ctx,
 
    return GL_TRUE;
 }
+
+
+GLboolean
+_mesa_validate_DrawArraysInstanced(GLcontext *ctx, GLenum mode, GLint first,
+                                   GLsizei count, GLsizei primcount)
+{
+   ASSERT_OUTSIDE_BEGIN_END_WITH_RETVAL(ctx, GL_FALSE);
+
+   if (primcount <= 0) {
+      if (primcount < 0)
+         _mesa_error(ctx, GL_INVALID_VALUE,
+                     "glDrawArraysInstancedARB(primcount)" );
+      return GL_FALSE;
+   }
+
+   return _mesa_validate_DrawArrays(ctx, mode, first, count);
+}
+
+
+GLboolean
+_mesa_validate_DrawElementsInstanced(GLcontext *ctx, GLenum mode,
+                                     GLsizei count, GLenum type,
+                                     const GLvoid *indices, GLsizei primcount)
+{
+   ASSERT_OUTSIDE_BEGIN_END_WITH_RETVAL(ctx, GL_FALSE);
+
+   if (primcount <= 0) {
+      if (primcount < 0)
+         _mesa_error(ctx, GL_INVALID_VALUE,
+                     "glDrawElementsInstancedARB(primcount)" );
+      return GL_FALSE;
+   }
+
+   return _mesa_validate_DrawElements(ctx, mode, count, type, indices);
+}
@@ -162,6 +162,7 @@ _mesa_initialize_array_object( GLcontext *ctx,
       obj->VertexAttrib[i].Ptr = NULL;
       obj->VertexAttrib[i].Enabled = GL_FALSE;
       obj->VertexAttrib[i].Normalized = GL_FALSE;
+      obj->VertexAttrib[i].Divisor = 0;
    }
 
 #if FEATURE_point_size_array
@@ -292,6 +292,7 @@ _mesa_buffer_data( GLcontext *ctx, GLenum target, GLsizeiptrARB size,
       bufObj->Data = (GLubyte *) new_data;
       bufObj->Size = size;
       bufObj->Usage = usage;
+      bufObj->Stamp++;
 
       if (data) {
 	 _mesa_memcpy( bufObj->Data, data, size );
@@ -330,6 +331,7 @@ _mesa_buffer_subdata( GLcontext *ctx, GLenum target, GLintptrARB offset,
 
    if (bufObj->Data) {
       _mesa_memcpy( (GLubyte *) bufObj->Data + offset, data, size );
+      bufObj->Stamp++;
    }
 }
 
@@ -387,13 +389,17 @@ _mesa_buffer_map( GLcontext *ctx, GLenum target, GLenum access,
 {
    (void) ctx;
    (void) target;
-   (void) access;
    ASSERT(!bufObj->OnCard);
    /* Just return a direct pointer to the data */
    if (bufObj->Pointer) {
       /* already mapped! */
       return NULL;
    }
+   /* Anything derived from the contents is stale once the caller may
+    * write through the mapping.
+    */
+   if (access != GL_READ_ONLY_ARB)
+      bufObj->Stamp++;
    bufObj->Pointer = bufObj->Data;
    return bufObj->Pointer;
 }
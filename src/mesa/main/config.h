@@ -154,9 +154,9 @@
 #define HISTOGRAM_TABLE_SIZE 256
 
 /** Max convolution filter width */
-#define MAX_CONVOLUTION_WIDTH 9
+#define MAX_CONVOLUTION_WIDTH 15
 /** Max convolution filter height */
-#define MAX_CONVOLUTION_HEIGHT 9
+#define MAX_CONVOLUTION_HEIGHT 15
 
 /** For GL_ARB_texture_compression */
 #define MAX_COMPRESSED_TEXTURE_FORMATS 25
@@ -147,6 +147,7 @@
 #include "glapi/glapitable.h"
 #if FEATURE_NV_vertex_program || FEATURE_NV_fragment_program
 #include "shader/program.h"
+#include "shader/prog_cache.h"
 #endif
 #include "shader/shader_api.h"
 #if FEATURE_ATI_fragment_shader
@@ -359,6 +360,14 @@ _mesa_destroy_visual( GLvisual *vis )
  */
 _glthread_DECLARE_STATIC_MUTEX(OneTimeLock);
 
+/**
+ * Highest __GLcontextRec::_StateSerial reached by any destroyed context.
+ * New contexts count on from here so that values cached against a dead
+ * context at the same address are never taken to be current.
+ * Protected by OneTimeLock.
+ */
+static GLuint StateSerialBase = 0;
+
 /**
  * Calls all the various one-time-init functions in Mesa.
  *
@@ -453,6 +462,12 @@ alloc_shared_state( GLcontext *ctx )
    if (!ss->DefaultFragmentProgram)
       goto cleanup;
 #endif
+   ss->VertexProgramCache = _mesa_new_program_cache();
+   if (!ss->VertexProgramCache)
+      goto cleanup;
+   ss->FragmentProgramCache = _mesa_new_program_cache();
+   if (!ss->FragmentProgramCache)
+      goto cleanup;
 #if FEATURE_ATI_fragment_shader
    ss->ATIShaders = _mesa_NewHashTable();
    ss->DefaultFragmentShader = _mesa_new_ati_fragment_shader(ctx, 0);
@@ -529,6 +544,10 @@ cleanup:
 #if FEATURE_ARB_fragment_program
    _mesa_reference_fragprog(ctx, &ss->DefaultFragmentProgram, NULL);
 #endif
+   if (ss->VertexProgramCache)
+      _mesa_delete_program_cache(ctx, ss->VertexProgramCache);
+   if (ss->FragmentProgramCache)
+      _mesa_delete_program_cache(ctx, ss->FragmentProgramCache);
 #if FEATURE_ATI_fragment_shader
    if (ss->DefaultFragmentShader)
       _mesa_delete_ati_fragment_shader(ctx, ss->DefaultFragmentShader);
@@ -743,6 +762,9 @@ free_shared_state( GLcontext *ctx, struct gl_shared_state *ss )
    _mesa_HashDeleteAll(ss->Programs, delete_program_cb, ctx);
    _mesa_DeleteHashTable(ss->Programs);
 
+   _mesa_delete_program_cache(ctx, ss->VertexProgramCache);
+   _mesa_delete_program_cache(ctx, ss->FragmentProgramCache);
+
 #if FEATURE_ARB_vertex_program
    _mesa_reference_vertprog(ctx, &ss->DefaultVertexProgram, NULL);
 #endif
@@ -935,6 +957,21 @@ _mesa_init_constants(GLcontext *ctx)
    ctx->Const.MaxVarying = MAX_VARYING;
 #endif
 
+   /* Compress large generic RGB/RGBA textures on upload?
+    * MESA_COMPRESS_TEXTURES may give the minimum number of texels.
+    */
+   {
+      const char *env = _mesa_getenv("MESA_COMPRESS_TEXTURES");
+      if (env) {
+         const GLint minTexels = _mesa_atoi(env);
+         ctx->Const.CompressTexturesMinTexels
+            = minTexels > 0 ? minTexels : 256 * 256;
+      }
+      else {
+         ctx->Const.CompressTexturesMinTexels = 0;
+      }
+   }
+
    /* sanity checks */
    ASSERT(ctx->Const.MaxTextureUnits == MIN2(ctx->Const.MaxTextureImageUnits,
                                              ctx->Const.MaxTextureCoordUnits));
@@ -1064,6 +1101,10 @@ init_attrib_groups(GLcontext *ctx)
    ctx->NewState = _NEW_ALL;
    ctx->ErrorValue = (GLenum) GL_NO_ERROR;
 
+   _glthread_LOCK_MUTEX(OneTimeLock);
+   ctx->_StateSerial = StateSerialBase;
+   _glthread_UNLOCK_MUTEX(OneTimeLock);
+
    return GL_TRUE;
 }
 
@@ -1301,20 +1342,17 @@ _mesa_free_context_data( GLcontext *ctx )
       _mesa_make_current(ctx, NULL, NULL);
    }
 
+   _glthread_LOCK_MUTEX(OneTimeLock);
+   if ((GLint) (ctx->_StateSerial - StateSerialBase) > 0)
+      StateSerialBase = ctx->_StateSerial;
+   _glthread_UNLOCK_MUTEX(OneTimeLock);
+
    /* unreference WinSysDraw/Read buffers */
    _mesa_unreference_framebuffer(&ctx->WinSysDrawBuffer);
    _mesa_unreference_framebuffer(&ctx->WinSysReadBuffer);
    _mesa_unreference_framebuffer(&ctx->DrawBuffer);
    _mesa_unreference_framebuffer(&ctx->ReadBuffer);
 
-   _mesa_reference_vertprog(ctx, &ctx->VertexProgram.Current, NULL);
-   _mesa_reference_vertprog(ctx, &ctx->VertexProgram._Current, NULL);
-   _mesa_reference_vertprog(ctx, &ctx->VertexProgram._TnlProgram, NULL);
-
-   _mesa_reference_fragprog(ctx, &ctx->FragmentProgram.Current, NULL);
-   _mesa_reference_fragprog(ctx, &ctx->FragmentProgram._Current, NULL);
-   _mesa_reference_fragprog(ctx, &ctx->FragmentProgram._TexEnvProgram, NULL);
-
    _mesa_free_attrib_data(ctx);
    _mesa_free_lighting_data( ctx );
 #if FEATURE_evaluators
@@ -39,6 +39,7 @@
 #include "image.h"
 #include "mtypes.h"
 #include "pixel.h"
+#include "rowthreads.h"
 #include "state.h"
 
 
@@ -984,402 +985,368 @@ _mesa_SeparableFilter2D(GLenum target, GLenum internalFormat, GLsizei width, GLs
 /***                   image convolution functions                  ***/
 /**********************************************************************/
 
-static void
-convolve_1d_reduce(GLint srcWidth, const GLfloat src[][4],
-                   GLint filterWidth, const GLfloat filter[][4],
-                   GLfloat dest[][4])
-{
-   GLint dstWidth;
-   GLint i, n;
+/*
+ * All the convolutions are done a row at a time: convolve_row() applies
+ * each filter tap to a whole row of pixels, which the compiler can
+ * vectorize.  The border modes are handled by padding the source rows,
+ * so they all share the same inner loop.  Two dimensional filters which
+ * are the outer product of a row and a column filter are applied as
+ * separable filters, in two passes.
+ */
 
-   if (filterWidth >= 1)
-      dstWidth = srcWidth - (filterWidth - 1);
-   else
-      dstWidth = srcWidth;
 
-   if (dstWidth <= 0)
-      return;  /* null result */
-
-   for (i = 0; i < dstWidth; i++) {
-      GLfloat sumR = 0.0;
-      GLfloat sumG = 0.0;
-      GLfloat sumB = 0.0;
-      GLfloat sumA = 0.0;
-      for (n = 0; n < filterWidth; n++) {
-         sumR += src[i + n][RCOMP] * filter[n][RCOMP];
-         sumG += src[i + n][GCOMP] * filter[n][GCOMP];
-         sumB += src[i + n][BCOMP] * filter[n][BCOMP];
-         sumA += src[i + n][ACOMP] * filter[n][ACOMP];
-      }
-      dest[i][RCOMP] = sumR;
-      dest[i][GCOMP] = sumG;
-      dest[i][BCOMP] = sumB;
-      dest[i][ACOMP] = sumA;
-   }
-}
+/**
+ * Parameters of an image convolution, for convolve_rows().
+ */
+struct convolve_job {
+   GLint srcWidth, srcHeight;
+   const GLfloat (*src)[4];
+   GLint filterWidth, filterHeight;
+   const GLfloat (*filter)[4];        /**< 2D filter, or NULL if separable */
+   const GLfloat (*rowFilt)[4];
+   const GLfloat (*colFilt)[4];
+   GLenum borderMode;
+   const GLfloat *borderColor;
+   GLint dstWidth, dstHeight;
+   GLfloat (*temp)[4];                /**< row filtered image if separable */
+   GLfloat (*dest)[4];
+   GLboolean rowPass;                 /**< first pass of a separable filter? */
+};
 
 
+/**
+ * dest[i] += src[i + n] * filter[n] for n < filterWidth and i < width.
+ */
 static void
-convolve_1d_constant(GLint srcWidth, const GLfloat src[][4],
-                     GLint filterWidth, const GLfloat filter[][4],
-                     GLfloat dest[][4],
-                     const GLfloat borderColor[4])
+convolve_row(GLint width, const GLfloat src[][4],
+             GLint filterWidth, const GLfloat filter[][4],
+             GLfloat dest[][4])
 {
-   const GLint halfFilterWidth = filterWidth / 2;
    GLint i, n;
 
-   for (i = 0; i < srcWidth; i++) {
-      GLfloat sumR = 0.0;
-      GLfloat sumG = 0.0;
-      GLfloat sumB = 0.0;
-      GLfloat sumA = 0.0;
-      for (n = 0; n < filterWidth; n++) {
-         if (i + n < halfFilterWidth || i + n - halfFilterWidth >= srcWidth) {
-            sumR += borderColor[RCOMP] * filter[n][RCOMP];
-            sumG += borderColor[GCOMP] * filter[n][GCOMP];
-            sumB += borderColor[BCOMP] * filter[n][BCOMP];
-            sumA += borderColor[ACOMP] * filter[n][ACOMP];
-         }
-         else {
-            sumR += src[i + n - halfFilterWidth][RCOMP] * filter[n][RCOMP];
-            sumG += src[i + n - halfFilterWidth][GCOMP] * filter[n][GCOMP];
-            sumB += src[i + n - halfFilterWidth][BCOMP] * filter[n][BCOMP];
-            sumA += src[i + n - halfFilterWidth][ACOMP] * filter[n][ACOMP];
-         }
+   for (n = 0; n < filterWidth; n++) {
+      const GLfloat r = filter[n][RCOMP], g = filter[n][GCOMP];
+      const GLfloat b = filter[n][BCOMP], a = filter[n][ACOMP];
+      const GLfloat (*s)[4] = src + n;
+      for (i = 0; i < width; i++) {
+         dest[i][RCOMP] += s[i][RCOMP] * r;
+         dest[i][GCOMP] += s[i][GCOMP] * g;
+         dest[i][BCOMP] += s[i][BCOMP] * b;
+         dest[i][ACOMP] += s[i][ACOMP] * a;
       }
-      dest[i][RCOMP] = sumR;
-      dest[i][GCOMP] = sumG;
-      dest[i][BCOMP] = sumB;
-      dest[i][ACOMP] = sumA;
    }
 }
 
 
-static void
-convolve_1d_replicate(GLint srcWidth, const GLfloat src[][4],
-                      GLint filterWidth, const GLfloat filter[][4],
-                      GLfloat dest[][4])
+/**
+ * Return pixels [x0, x0 + width) of source row <j> padded for
+ * convolution with the job's row filter: border pixels are added to the
+ * left and right so that output pixel x0 + i is computed from padded
+ * pixels i .. i + filterWidth - 1.  Rows above or below the image are
+ * border rows, or replicate the first or last row.  With GL_REDUCE no
+ * padding is needed and a pointer into the source image is returned.
+ */
+static const GLfloat (*
+padded_row(const struct convolve_job *job, GLint j, GLint x0, GLint width,
+           GLfloat buffer[][4]))[4]
 {
-   const GLint halfFilterWidth = filterWidth / 2;
-   GLint i, n;
-
-   for (i = 0; i < srcWidth; i++) {
-      GLfloat sumR = 0.0;
-      GLfloat sumG = 0.0;
-      GLfloat sumB = 0.0;
-      GLfloat sumA = 0.0;
-      for (n = 0; n < filterWidth; n++) {
-         if (i + n < halfFilterWidth) {
-            sumR += src[0][RCOMP] * filter[n][RCOMP];
-            sumG += src[0][GCOMP] * filter[n][GCOMP];
-            sumB += src[0][BCOMP] * filter[n][BCOMP];
-            sumA += src[0][ACOMP] * filter[n][ACOMP];
-         }
-         else if (i + n - halfFilterWidth >= srcWidth) {
-            sumR += src[srcWidth - 1][RCOMP] * filter[n][RCOMP];
-            sumG += src[srcWidth - 1][GCOMP] * filter[n][GCOMP];
-            sumB += src[srcWidth - 1][BCOMP] * filter[n][BCOMP];
-            sumA += src[srcWidth - 1][ACOMP] * filter[n][ACOMP];
-         }
-         else {
-            sumR += src[i + n - halfFilterWidth][RCOMP] * filter[n][RCOMP];
-            sumG += src[i + n - halfFilterWidth][GCOMP] * filter[n][GCOMP];
-            sumB += src[i + n - halfFilterWidth][BCOMP] * filter[n][BCOMP];
-            sumA += src[i + n - halfFilterWidth][ACOMP] * filter[n][ACOMP];
-         }
+   const GLint srcWidth = job->srcWidth;
+   const GLint n = width + job->filterWidth - 1;
+   const GLint sx0 = x0 - job->filterWidth / 2;
+   const GLfloat *leftColor, *rightColor;
+   GLint i, first, last;
+
+   if (job->borderMode == GL_REDUCE)
+      return job->src + j * srcWidth + x0;
+
+   if (j < 0 || j >= job->srcHeight) {
+      if (job->borderMode == GL_CONSTANT_BORDER) {
+         for (i = 0; i < n; i++)
+            COPY_4V(buffer[i], job->borderColor);
+         return (const GLfloat (*)[4]) buffer;
       }
-      dest[i][RCOMP] = sumR;
-      dest[i][GCOMP] = sumG;
-      dest[i][BCOMP] = sumB;
-      dest[i][ACOMP] = sumA;
+      j = CLAMP(j, 0, job->srcHeight - 1);
    }
-}
 
+   if (job->borderMode == GL_CONSTANT_BORDER) {
+      leftColor = rightColor = job->borderColor;
+   }
+   else {
+      leftColor = job->src[j * srcWidth];
+      rightColor = job->src[j * srcWidth + srcWidth - 1];
+   }
 
-static void
-convolve_2d_reduce(GLint srcWidth, GLint srcHeight,
-                   const GLfloat src[][4],
-                   GLint filterWidth, GLint filterHeight,
-                   const GLfloat filter[][4],
-                   GLfloat dest[][4])
-{
-   GLint dstWidth, dstHeight;
-   GLint i, j, n, m;
+   /* buffer[first, last) lies inside the source row */
+   first = CLAMP(-sx0, 0, n);
+   last = CLAMP(srcWidth - sx0, first, n);
 
-   if (filterWidth >= 1)
-      dstWidth = srcWidth - (filterWidth - 1);
-   else
-      dstWidth = srcWidth;
+   for (i = 0; i < first; i++)
+      COPY_4V(buffer[i], leftColor);
+   _mesa_memcpy(buffer + first, job->src + j * srcWidth + sx0 + first,
+                (last - first) * 4 * sizeof(GLfloat));
+   for (i = last; i < n; i++)
+      COPY_4V(buffer[i], rightColor);
 
-   if (filterHeight >= 1)
-      dstHeight = srcHeight - (filterHeight - 1);
-   else
-      dstHeight = srcHeight;
+   return (const GLfloat (*)[4]) buffer;
+}
 
-   if (dstWidth <= 0 || dstHeight <= 0)
-      return;
 
-   for (j = 0; j < dstHeight; j++) {
-      for (i = 0; i < dstWidth; i++) {
-         GLfloat sumR = 0.0;
-         GLfloat sumG = 0.0;
-         GLfloat sumB = 0.0;
-         GLfloat sumA = 0.0;
-         for (m = 0; m < filterHeight; m++) {
-            for (n = 0; n < filterWidth; n++) {
-               const GLint k = (j + m) * srcWidth + i + n;
-               const GLint f = m * filterWidth + n;
-               sumR += src[k][RCOMP] * filter[f][RCOMP];
-               sumG += src[k][GCOMP] * filter[f][GCOMP];
-               sumB += src[k][BCOMP] * filter[f][BCOMP];
-               sumA += src[k][ACOMP] * filter[f][ACOMP];
-            }
-         }
-         dest[j * dstWidth + i][RCOMP] = sumR;
-         dest[j * dstWidth + i][GCOMP] = sumG;
-         dest[j * dstWidth + i][BCOMP] = sumB;
-         dest[j * dstWidth + i][ACOMP] = sumA;
-      }
+/**
+ * Add source row <j>, convolved with a filter of the job's filterWidth,
+ * to dest.  The row is padded in pieces of up to MAX_WIDTH pixels so
+ * that the padding buffer fits on the stack.
+ */
+static void
+convolve_padded_row(const struct convolve_job *job, GLint j,
+                    const GLfloat filter[][4], GLfloat dest[][4])
+{
+   GLfloat buffer[MAX_WIDTH + MAX_CONVOLUTION_WIDTH - 1][4];
+   GLint x0;
+
+   for (x0 = 0; x0 < job->dstWidth; x0 += MAX_WIDTH) {
+      const GLint width = MIN2(job->dstWidth - x0, MAX_WIDTH);
+      convolve_row(width, padded_row(job, j, x0, width, buffer),
+                   job->filterWidth, filter, dest + x0);
    }
 }
 
 
+/**
+ * Do one pass of a convolution for the rows [y0, y1).
+ * See _mesa_run_row_threads().
+ */
 static void
-convolve_2d_constant(GLint srcWidth, GLint srcHeight,
-                     const GLfloat src[][4],
-                     GLint filterWidth, GLint filterHeight,
-                     const GLfloat filter[][4],
-                     GLfloat dest[][4],
-                     const GLfloat borderColor[4])
+convolve_rows(void *data, GLuint thread, GLint y0, GLint y1)
 {
-   const GLint halfFilterWidth = filterWidth / 2;
-   const GLint halfFilterHeight = filterHeight / 2;
-   GLint i, j, n, m;
-
-   for (j = 0; j < srcHeight; j++) {
-      for (i = 0; i < srcWidth; i++) {
-         GLfloat sumR = 0.0;
-         GLfloat sumG = 0.0;
-         GLfloat sumB = 0.0;
-         GLfloat sumA = 0.0;
-         for (m = 0; m < filterHeight; m++) {
-            for (n = 0; n < filterWidth; n++) {
-               const GLint f = m * filterWidth + n;
-               const GLint is = i + n - halfFilterWidth;
-               const GLint js = j + m - halfFilterHeight;
-               if (is < 0 || is >= srcWidth ||
-                   js < 0 || js >= srcHeight) {
-                  sumR += borderColor[RCOMP] * filter[f][RCOMP];
-                  sumG += borderColor[GCOMP] * filter[f][GCOMP];
-                  sumB += borderColor[BCOMP] * filter[f][BCOMP];
-                  sumA += borderColor[ACOMP] * filter[f][ACOMP];
-               }
-               else {
-                  const GLint k = js * srcWidth + is;
-                  sumR += src[k][RCOMP] * filter[f][RCOMP];
-                  sumG += src[k][GCOMP] * filter[f][GCOMP];
-                  sumB += src[k][BCOMP] * filter[f][BCOMP];
-                  sumA += src[k][ACOMP] * filter[f][ACOMP];
+   const struct convolve_job *job = (const struct convolve_job *) data;
+   const GLint dstWidth = job->dstWidth;
+   const GLint offset = (job->borderMode == GL_REDUCE)
+      ? 0 : -(job->filterHeight / 2);
+   GLint j, m;
+
+   (void) thread;
+
+   for (j = y0; j < y1; j++) {
+      if (job->rowPass) {
+         /* apply the row filter to a source row */
+         GLfloat (*dest)[4] = job->temp + j * dstWidth;
+         _mesa_bzero(dest, dstWidth * 4 * sizeof(GLfloat));
+         convolve_padded_row(job, j, job->rowFilt, dest);
+      }
+      else if (!job->filter) {
+         /* apply the column filter to the row filtered image */
+         GLfloat (*dest)[4] = job->dest + j * dstWidth;
+         _mesa_bzero(dest, dstWidth * 4 * sizeof(GLfloat));
+         for (m = 0; m < job->filterHeight; m++) {
+            GLint js = j + m + offset;
+            if (js < 0 || js >= job->srcHeight) {
+               if (job->borderMode == GL_CONSTANT_BORDER) {
+                  /* a row filtered border row is the same everywhere */
+                  const GLfloat *bc = job->borderColor;
+                  const GLfloat *f = job->colFilt[m];
+                  GLfloat sum[4];
+                  GLint i, n;
+                  ASSIGN_4V(sum, 0.0F, 0.0F, 0.0F, 0.0F);
+                  for (n = 0; n < job->filterWidth; n++) {
+                     sum[RCOMP] += bc[RCOMP] * job->rowFilt[n][RCOMP];
+                     sum[GCOMP] += bc[GCOMP] * job->rowFilt[n][GCOMP];
+                     sum[BCOMP] += bc[BCOMP] * job->rowFilt[n][BCOMP];
+                     sum[ACOMP] += bc[ACOMP] * job->rowFilt[n][ACOMP];
+                  }
+                  for (i = 0; i < dstWidth; i++) {
+                     dest[i][RCOMP] += sum[RCOMP] * f[RCOMP];
+                     dest[i][GCOMP] += sum[GCOMP] * f[GCOMP];
+                     dest[i][BCOMP] += sum[BCOMP] * f[BCOMP];
+                     dest[i][ACOMP] += sum[ACOMP] * f[ACOMP];
+                  }
+                  continue;
                }
+               js = CLAMP(js, 0, job->srcHeight - 1);
             }
+            convolve_row(dstWidth,
+                         (const GLfloat (*)[4]) (job->temp + js * dstWidth),
+                         1, job->colFilt + m, dest);
+         }
+      }
+      else {
+         /* general 2D filter */
+         GLfloat (*dest)[4] = job->dest + j * dstWidth;
+         _mesa_bzero(dest, dstWidth * 4 * sizeof(GLfloat));
+         for (m = 0; m < job->filterHeight; m++) {
+            convolve_padded_row(job, j + m + offset,
+                                job->filter + m * job->filterWidth, dest);
          }
-         dest[j * srcWidth + i][RCOMP] = sumR;
-         dest[j * srcWidth + i][GCOMP] = sumG;
-         dest[j * srcWidth + i][BCOMP] = sumB;
-         dest[j * srcWidth + i][ACOMP] = sumA;
       }
    }
 }
 
 
+#define CONVOLVE_MIN_WORK_PER_THREAD (1024 * 1024)
+
+
+/**
+ * Do one pass of a convolution over the given number of rows, with
+ * several threads if the image is big enough.  Every row is computed
+ * the same way, so the result doesn't depend on the thread count.
+ */
 static void
-convolve_2d_replicate(GLint srcWidth, GLint srcHeight,
-                      const GLfloat src[][4],
-                      GLint filterWidth, GLint filterHeight,
-                      const GLfloat filter[][4],
-                      GLfloat dest[][4])
+run_convolve_pass(struct convolve_job *job, GLint rows)
 {
-   const GLint halfFilterWidth = filterWidth / 2;
-   const GLint halfFilterHeight = filterHeight / 2;
-   GLint i, j, n, m;
-
-   for (j = 0; j < srcHeight; j++) {
-      for (i = 0; i < srcWidth; i++) {
-         GLfloat sumR = 0.0;
-         GLfloat sumG = 0.0;
-         GLfloat sumB = 0.0;
-         GLfloat sumA = 0.0;
-         for (m = 0; m < filterHeight; m++) {
-            for (n = 0; n < filterWidth; n++) {
-               const GLint f = m * filterWidth + n;
-               GLint is = i + n - halfFilterWidth;
-               GLint js = j + m - halfFilterHeight;
-               GLint k;
-               if (is < 0)
-                  is = 0;
-               else if (is >= srcWidth)
-                  is = srcWidth - 1;
-               if (js < 0)
-                  js = 0;
-               else if (js >= srcHeight)
-                  js = srcHeight - 1;
-               k = js * srcWidth + is;
-               sumR += src[k][RCOMP] * filter[f][RCOMP];
-               sumG += src[k][GCOMP] * filter[f][GCOMP];
-               sumB += src[k][BCOMP] * filter[f][BCOMP];
-               sumA += src[k][ACOMP] * filter[f][ACOMP];
-            }
-         }
-         dest[j * srcWidth + i][RCOMP] = sumR;
-         dest[j * srcWidth + i][GCOMP] = sumG;
-         dest[j * srcWidth + i][BCOMP] = sumB;
-         dest[j * srcWidth + i][ACOMP] = sumA;
-      }
-   }
+   GLint taps;
+
+   if (job->rowPass)
+      taps = job->filterWidth;
+   else if (!job->filter)
+      taps = job->filterHeight;
+   else
+      taps = job->filterWidth * job->filterHeight;
+
+   _mesa_run_row_threads(_mesa_num_row_threads(rows,
+                                               (GLfloat) job->dstWidth
+                                               * rows * taps,
+                                               CONVOLVE_MIN_WORK_PER_THREAD),
+                         0, rows, convolve_rows, job);
 }
 
 
+/**
+ * Convolve an image with either a 2D filter or a pair of row and column
+ * filters.  If rowFilt and colFilt are given, the image is convolved
+ * with them in two passes, and filter, if not NULL, is the equivalent
+ * 2D filter.  With GL_REDUCE the destination image is smaller than the
+ * source, otherwise it has the same size.
+ */
 static void
-convolve_sep_reduce(GLint srcWidth, GLint srcHeight,
-                    const GLfloat src[][4],
-                    GLint filterWidth, GLint filterHeight,
-                    const GLfloat rowFilt[][4],
-                    const GLfloat colFilt[][4],
-                    GLfloat dest[][4])
+convolve_image(GLint srcWidth, GLint srcHeight, const GLfloat src[][4],
+               GLint filterWidth, GLint filterHeight,
+               const GLfloat filter[][4],
+               const GLfloat rowFilt[][4], const GLfloat colFilt[][4],
+               GLenum borderMode, const GLfloat borderColor[4],
+               GLfloat dest[][4])
 {
-   GLint dstWidth, dstHeight;
-   GLint i, j, n, m;
+   GLfloat outer[MAX_CONVOLUTION_WIDTH * MAX_CONVOLUTION_HEIGHT][4];
+   struct convolve_job job;
 
-   if (filterWidth >= 1)
-      dstWidth = srcWidth - (filterWidth - 1);
-   else
-      dstWidth = srcWidth;
+   job.dstWidth = srcWidth;
+   job.dstHeight = srcHeight;
+   if (borderMode == GL_REDUCE) {
+      if (filterWidth >= 1)
+         job.dstWidth = srcWidth - (filterWidth - 1);
+      if (filterHeight >= 1)
+         job.dstHeight = srcHeight - (filterHeight - 1);
+   }
 
-   if (filterHeight >= 1)
-      dstHeight = srcHeight - (filterHeight - 1);
-   else
-      dstHeight = srcHeight;
+   if (job.dstWidth <= 0 || job.dstHeight <= 0)
+      return;  /* null result */
 
-   if (dstWidth <= 0 || dstHeight <= 0)
+   if (filterWidth < 1 || filterHeight < 1) {
+      /* empty filter */
+      _mesa_bzero(dest, job.dstWidth * job.dstHeight * 4 * sizeof(GLfloat));
       return;
+   }
 
-   for (j = 0; j < dstHeight; j++) {
-      for (i = 0; i < dstWidth; i++) {
-         GLfloat sumR = 0.0;
-         GLfloat sumG = 0.0;
-         GLfloat sumB = 0.0;
-         GLfloat sumA = 0.0;
+   job.srcWidth = srcWidth;
+   job.srcHeight = srcHeight;
+   job.src = src;
+   job.filterWidth = filterWidth;
+   job.filterHeight = filterHeight;
+   job.filter = filter;
+   job.rowFilt = rowFilt;
+   job.colFilt = colFilt;
+   job.borderMode = borderMode;
+   job.borderColor = borderColor;
+   job.temp = NULL;
+   job.dest = dest;
+   job.rowPass = GL_FALSE;
+
+   if (rowFilt) {
+      job.temp = (GLfloat (*)[4])
+         _mesa_malloc(job.dstWidth * srcHeight * 4 * sizeof(GLfloat));
+      if (job.temp) {
+         job.filter = NULL;
+         job.rowPass = GL_TRUE;
+         run_convolve_pass(&job, srcHeight);
+         job.rowPass = GL_FALSE;
+      }
+      else if (!filter) {
+         /* no memory for the row filtered image, so apply the outer
+          * product of the row and column filters as a 2D filter
+          */
+         GLint m, n;
          for (m = 0; m < filterHeight; m++) {
             for (n = 0; n < filterWidth; n++) {
-               GLint k = (j + m) * srcWidth + i + n;
-               sumR += src[k][RCOMP] * rowFilt[n][RCOMP] * colFilt[m][RCOMP];
-               sumG += src[k][GCOMP] * rowFilt[n][GCOMP] * colFilt[m][GCOMP];
-               sumB += src[k][BCOMP] * rowFilt[n][BCOMP] * colFilt[m][BCOMP];
-               sumA += src[k][ACOMP] * rowFilt[n][ACOMP] * colFilt[m][ACOMP];
+               GLfloat *f = outer[m * filterWidth + n];
+               f[RCOMP] = rowFilt[n][RCOMP] * colFilt[m][RCOMP];
+               f[GCOMP] = rowFilt[n][GCOMP] * colFilt[m][GCOMP];
+               f[BCOMP] = rowFilt[n][BCOMP] * colFilt[m][BCOMP];
+               f[ACOMP] = rowFilt[n][ACOMP] * colFilt[m][ACOMP];
             }
          }
-         dest[j * dstWidth + i][RCOMP] = sumR;
-         dest[j * dstWidth + i][GCOMP] = sumG;
-         dest[j * dstWidth + i][BCOMP] = sumB;
-         dest[j * dstWidth + i][ACOMP] = sumA;
+         job.filter = (const GLfloat (*)[4]) outer;
       }
    }
+
+   run_convolve_pass(&job, job.dstHeight);
+
+   if (job.temp)
+      _mesa_free(job.temp);
 }
 
 
-static void
-convolve_sep_constant(GLint srcWidth, GLint srcHeight,
-                      const GLfloat src[][4],
-                      GLint filterWidth, GLint filterHeight,
-                      const GLfloat rowFilt[][4],
-                      const GLfloat colFilt[][4],
-                      GLfloat dest[][4],
-                      const GLfloat borderColor[4])
+/**
+ * If each channel of a 2D filter is the outer product of a column and a
+ * row vector, find those vectors so that the filter can be applied as a
+ * separable one.  This is the case for most blur filters.
+ */
+static GLboolean
+separate_filter(GLint width, GLint height, const GLfloat filter[][4],
+                GLfloat rowFilt[][4], GLfloat colFilt[][4])
 {
-   const GLint halfFilterWidth = filterWidth / 2;
-   const GLint halfFilterHeight = filterHeight / 2;
-   GLint i, j, n, m;
-
-   for (j = 0; j < srcHeight; j++) {
-      for (i = 0; i < srcWidth; i++) {
-         GLfloat sumR = 0.0;
-         GLfloat sumG = 0.0;
-         GLfloat sumB = 0.0;
-         GLfloat sumA = 0.0;
-         for (m = 0; m < filterHeight; m++) {
-            for (n = 0; n < filterWidth; n++) {
-               const GLint is = i + n - halfFilterWidth;
-               const GLint js = j + m - halfFilterHeight;
-               if (is < 0 || is >= srcWidth ||
-                   js < 0 || js >= srcHeight) {
-                  sumR += borderColor[RCOMP] * rowFilt[n][RCOMP] * colFilt[m][RCOMP];
-                  sumG += borderColor[GCOMP] * rowFilt[n][GCOMP] * colFilt[m][GCOMP];
-                  sumB += borderColor[BCOMP] * rowFilt[n][BCOMP] * colFilt[m][BCOMP];
-                  sumA += borderColor[ACOMP] * rowFilt[n][ACOMP] * colFilt[m][ACOMP];
-               }
-               else {
-                  GLint k = js * srcWidth + is;
-                  sumR += src[k][RCOMP] * rowFilt[n][RCOMP] * colFilt[m][RCOMP];
-                  sumG += src[k][GCOMP] * rowFilt[n][GCOMP] * colFilt[m][GCOMP];
-                  sumB += src[k][BCOMP] * rowFilt[n][BCOMP] * colFilt[m][BCOMP];
-                  sumA += src[k][ACOMP] * rowFilt[n][ACOMP] * colFilt[m][ACOMP];
-               }
-
+   GLint c, m, n;
+
+   if (width < 2 || height < 2)
+      return GL_FALSE;  /* nothing to gain */
+
+   for (c = 0; c < 4; c++) {
+      GLint pm = 0, pn = 0;
+      GLfloat max = 0.0F, tolerance;
+
+      /* pick the largest element as the pivot */
+      for (m = 0; m < height; m++) {
+         for (n = 0; n < width; n++) {
+            const GLfloat f = FABSF(filter[m * width + n][c]);
+            if (f > max) {
+               max = f;
+               pm = m;
+               pn = n;
             }
          }
-         dest[j * srcWidth + i][RCOMP] = sumR;
-         dest[j * srcWidth + i][GCOMP] = sumG;
-         dest[j * srcWidth + i][BCOMP] = sumB;
-         dest[j * srcWidth + i][ACOMP] = sumA;
       }
-   }
-}
 
+      if (max == 0.0F) {
+         for (n = 0; n < width; n++)
+            rowFilt[n][c] = 0.0F;
+         for (m = 0; m < height; m++)
+            colFilt[m][c] = 0.0F;
+         continue;
+      }
 
-static void
-convolve_sep_replicate(GLint srcWidth, GLint srcHeight,
-                       const GLfloat src[][4],
-                       GLint filterWidth, GLint filterHeight,
-                       const GLfloat rowFilt[][4],
-                       const GLfloat colFilt[][4],
-                       GLfloat dest[][4])
-{
-   const GLint halfFilterWidth = filterWidth / 2;
-   const GLint halfFilterHeight = filterHeight / 2;
-   GLint i, j, n, m;
-
-   for (j = 0; j < srcHeight; j++) {
-      for (i = 0; i < srcWidth; i++) {
-         GLfloat sumR = 0.0;
-         GLfloat sumG = 0.0;
-         GLfloat sumB = 0.0;
-         GLfloat sumA = 0.0;
-         for (m = 0; m < filterHeight; m++) {
-            for (n = 0; n < filterWidth; n++) {
-               GLint is = i + n - halfFilterWidth;
-               GLint js = j + m - halfFilterHeight;
-               GLint k;
-               if (is < 0)
-                  is = 0;
-               else if (is >= srcWidth)
-                  is = srcWidth - 1;
-               if (js < 0)
-                  js = 0;
-               else if (js >= srcHeight)
-                  js = srcHeight - 1;
-               k = js * srcWidth + is;
-               sumR += src[k][RCOMP] * rowFilt[n][RCOMP] * colFilt[m][RCOMP];
-               sumG += src[k][GCOMP] * rowFilt[n][GCOMP] * colFilt[m][GCOMP];
-               sumB += src[k][BCOMP] * rowFilt[n][BCOMP] * colFilt[m][BCOMP];
-               sumA += src[k][ACOMP] * rowFilt[n][ACOMP] * colFilt[m][ACOMP];
-            }
+      for (n = 0; n < width; n++)
+         rowFilt[n][c] = filter[pm * width + n][c];
+      for (m = 0; m < height; m++)
+         colFilt[m][c] = filter[m * width + pn][c] / filter[pm * width + pn][c];
+
+      tolerance = max * 1.0e-6F;
+      for (m = 0; m < height; m++) {
+         for (n = 0; n < width; n++) {
+            const GLfloat f = colFilt[m][c] * rowFilt[n][c];
+            if (FABSF(filter[m * width + n][c] - f) > tolerance)
+               return GL_FALSE;
          }
-         dest[j * srcWidth + i][RCOMP] = sumR;
-         dest[j * srcWidth + i][GCOMP] = sumG;
-         dest[j * srcWidth + i][BCOMP] = sumB;
-         dest[j * srcWidth + i][ACOMP] = sumA;
       }
    }
+
+   return GL_TRUE;
 }
 
 
@@ -1388,26 +1355,20 @@ void
 _mesa_convolve_1d_image(const GLcontext *ctx, GLsizei *width,
                         const GLfloat *srcImage, GLfloat *dstImage)
 {
-   switch (ctx->Pixel.ConvolutionBorderMode[0]) {
+   const GLenum borderMode = ctx->Pixel.ConvolutionBorderMode[0];
+
+   switch (borderMode) {
       case GL_REDUCE:
-         convolve_1d_reduce(*width, (const GLfloat (*)[4]) srcImage,
-                            ctx->Convolution1D.Width,
-                            (const GLfloat (*)[4]) ctx->Convolution1D.Filter,
-                            (GLfloat (*)[4]) dstImage);
-         *width = *width - (MAX2(ctx->Convolution1D.Width, 1) - 1);
-         break;
       case GL_CONSTANT_BORDER:
-         convolve_1d_constant(*width, (const GLfloat (*)[4]) srcImage,
-                              ctx->Convolution1D.Width,
-                              (const GLfloat (*)[4]) ctx->Convolution1D.Filter,
-                              (GLfloat (*)[4]) dstImage,
-                              ctx->Pixel.ConvolutionBorderColor[0]);
-         break;
       case GL_REPLICATE_BORDER:
-         convolve_1d_replicate(*width, (const GLfloat (*)[4]) srcImage,
-                              ctx->Convolution1D.Width,
-                              (const GLfloat (*)[4]) ctx->Convolution1D.Filter,
-                              (GLfloat (*)[4]) dstImage);
+         convolve_image(*width, 1, (const GLfloat (*)[4]) srcImage,
+                        ctx->Convolution1D.Width, 1,
+                        (const GLfloat (*)[4]) ctx->Convolution1D.Filter,
+                        NULL, NULL,
+                        borderMode, ctx->Pixel.ConvolutionBorderColor[0],
+                        (GLfloat (*)[4]) dstImage);
+         if (borderMode == GL_REDUCE)
+            *width = *width - (MAX2(ctx->Convolution1D.Width, 1) - 1);
          break;
       default:
          ;
@@ -1419,37 +1380,35 @@ void
 _mesa_convolve_2d_image(const GLcontext *ctx, GLsizei *width, GLsizei *height,
                         const GLfloat *srcImage, GLfloat *dstImage)
 {
-   switch (ctx->Pixel.ConvolutionBorderMode[1]) {
+   const GLenum borderMode = ctx->Pixel.ConvolutionBorderMode[1];
+   const GLint filterWidth = ctx->Convolution2D.Width;
+   const GLint filterHeight = ctx->Convolution2D.Height;
+   const GLfloat (*filter)[4]
+      = (const GLfloat (*)[4]) ctx->Convolution2D.Filter;
+   GLfloat rowFilt[MAX_CONVOLUTION_WIDTH][4];
+   GLfloat colFilt[MAX_CONVOLUTION_HEIGHT][4];
+   GLboolean separable;
+
+   switch (borderMode) {
       case GL_REDUCE:
-         convolve_2d_reduce(*width, *height,
-                            (const GLfloat (*)[4]) srcImage,
-                            ctx->Convolution2D.Width,
-                            ctx->Convolution2D.Height,
-                            (const GLfloat (*)[4]) ctx->Convolution2D.Filter,
-                            (GLfloat (*)[4]) dstImage);
-         *width = *width - (MAX2(ctx->Convolution2D.Width, 1) - 1);
-         *height = *height - (MAX2(ctx->Convolution2D.Height, 1) - 1);
-         break;
       case GL_CONSTANT_BORDER:
-         convolve_2d_constant(*width, *height,
-                              (const GLfloat (*)[4]) srcImage,
-                              ctx->Convolution2D.Width,
-                              ctx->Convolution2D.Height,
-                              (const GLfloat (*)[4]) ctx->Convolution2D.Filter,
-                              (GLfloat (*)[4]) dstImage,
-                              ctx->Pixel.ConvolutionBorderColor[1]);
-         break;
       case GL_REPLICATE_BORDER:
-         convolve_2d_replicate(*width, *height,
-                               (const GLfloat (*)[4]) srcImage,
-                               ctx->Convolution2D.Width,
-                               ctx->Convolution2D.Height,
-                               (const GLfloat (*)[4])ctx->Convolution2D.Filter,
-                               (GLfloat (*)[4]) dstImage);
+         separable = separate_filter(filterWidth, filterHeight, filter,
+                                     rowFilt, colFilt);
+         convolve_image(*width, *height, (const GLfloat (*)[4]) srcImage,
+                        filterWidth, filterHeight, filter,
+                        separable ? (const GLfloat (*)[4]) rowFilt : NULL,
+                        separable ? (const GLfloat (*)[4]) colFilt : NULL,
+                        borderMode, ctx->Pixel.ConvolutionBorderColor[1],
+                        (GLfloat (*)[4]) dstImage);
+         if (borderMode == GL_REDUCE) {
+            *width = *width - (MAX2(filterWidth, 1) - 1);
+            *height = *height - (MAX2(filterHeight, 1) - 1);
+         }
          break;
       default:
          ;
-      }
+   }
 }
 
 
@@ -1458,39 +1417,25 @@ _mesa_convolve_sep_image(const GLcontext *ctx,
                          GLsizei *width, GLsizei *height,
                          const GLfloat *srcImage, GLfloat *dstImage)
 {
+   const GLenum borderMode = ctx->Pixel.ConvolutionBorderMode[2];
    const GLfloat *rowFilter = ctx->Separable2D.Filter;
    const GLfloat *colFilter = rowFilter + 4 * MAX_CONVOLUTION_WIDTH;
 
-   switch (ctx->Pixel.ConvolutionBorderMode[2]) {
+   switch (borderMode) {
       case GL_REDUCE:
-         convolve_sep_reduce(*width, *height,
-                             (const GLfloat (*)[4]) srcImage,
-                             ctx->Separable2D.Width,
-                             ctx->Separable2D.Height,
-                             (const GLfloat (*)[4]) rowFilter,
-                             (const GLfloat (*)[4]) colFilter,
-                             (GLfloat (*)[4]) dstImage);
-         *width = *width - (MAX2(ctx->Separable2D.Width, 1) - 1);
-         *height = *height - (MAX2(ctx->Separable2D.Height, 1) - 1);
-         break;
       case GL_CONSTANT_BORDER:
-         convolve_sep_constant(*width, *height,
-                               (const GLfloat (*)[4]) srcImage,
-                               ctx->Separable2D.Width,
-                               ctx->Separable2D.Height,
-                               (const GLfloat (*)[4]) rowFilter,
-                               (const GLfloat (*)[4]) colFilter,
-                               (GLfloat (*)[4]) dstImage,
-                               ctx->Pixel.ConvolutionBorderColor[2]);
-         break;
       case GL_REPLICATE_BORDER:
-         convolve_sep_replicate(*width, *height,
-                                (const GLfloat (*)[4]) srcImage,
-                                ctx->Separable2D.Width,
-                                ctx->Separable2D.Height,
-                                (const GLfloat (*)[4]) rowFilter,
-                                (const GLfloat (*)[4]) colFilter,
-                                (GLfloat (*)[4]) dstImage);
+         convolve_image(*width, *height, (const GLfloat (*)[4]) srcImage,
+                        ctx->Separable2D.Width, ctx->Separable2D.Height,
+                        NULL,
+                        (const GLfloat (*)[4]) rowFilter,
+                        (const GLfloat (*)[4]) colFilter,
+                        borderMode, ctx->Pixel.ConvolutionBorderColor[2],
+                        (GLfloat (*)[4]) dstImage);
+         if (borderMode == GL_REDUCE) {
+            *width = *width - (MAX2(ctx->Separable2D.Width, 1) - 1);
+            *height = *height - (MAX2(ctx->Separable2D.Height, 1) - 1);
+         }
          break;
       default:
          ;
@@ -1113,6 +1113,16 @@ typedef struct {
    void (GLAPIENTRYP DrawRangeElements)( GLenum mode, GLuint start,
 			      GLuint end, GLsizei count,
 			      GLenum type, const GLvoid *indices );
+   void (GLAPIENTRYP MultiDrawArraysEXT)( GLenum mode, GLint *first,
+			       GLsizei *count, GLsizei primcount );
+   void (GLAPIENTRYP MultiDrawElementsEXT)( GLenum mode, const GLsizei *count,
+				 GLenum type, const GLvoid **indices,
+				 GLsizei primcount );
+   void (GLAPIENTRYP DrawArraysInstancedARB)( GLenum mode, GLint first,
+				   GLsizei count, GLsizei primcount );
+   void (GLAPIENTRYP DrawElementsInstancedARB)( GLenum mode, GLsizei count,
+				     GLenum type, const GLvoid *indices,
+				     GLsizei primcount );
    /*@}*/
 
    /**
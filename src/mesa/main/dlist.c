@@ -755,6 +755,8 @@ _mesa_alloc_instruction(GLcontext *ctx, GLuint opcode, GLuint bytes)
  * \param execute  function to execute the new display list command
  * \param destroy  function to destroy the new display list command
  * \param print  function to print the new display list command
+ * \param merge  function to merge two consecutive instances of the new
+ *               command, or NULL (see optimize_list())
  * \return  the new opcode number or -1 if error
  */
 GLint
@@ -762,7 +764,8 @@ _mesa_alloc_opcode(GLcontext *ctx,
                    GLuint size,
                    void (*execute) (GLcontext *, void *),
                    void (*destroy) (GLcontext *, void *),
-                   void (*print) (GLcontext *, void *))
+                   void (*print) (GLcontext *, void *),
+                   GLboolean (*merge) (GLcontext *, void *, void *))
 {
    if (ctx->ListExt.NumOpcodes < MAX_DLIST_EXT_OPCODES) {
       const GLuint i = ctx->ListExt.NumOpcodes++;
@@ -771,6 +774,7 @@ _mesa_alloc_opcode(GLcontext *ctx,
       ctx->ListExt.Opcode[i].Execute = execute;
       ctx->ListExt.Opcode[i].Destroy = destroy;
       ctx->ListExt.Opcode[i].Print = print;
+      ctx->ListExt.Opcode[i].Merge = merge;
       return i + OPCODE_EXT_0;
    }
    return -1;
@@ -6777,6 +6781,224 @@ _mesa_NewList(GLuint list, GLenum mode)
 }
 
 
+/**
+ * Max number of pieces of state tracked by optimize_list().
+ */
+#define MAX_LIST_OPT_STATE 32
+
+
+/**
+ * Number of nodes taken by the instruction at n.
+ */
+static GLuint
+instruction_size(const GLcontext *ctx, const Node *n)
+{
+   const GLint i = (GLint) n[0].opcode - (GLint) OPCODE_EXT_0;
+   if (i >= 0 && i < (GLint) ctx->ListExt.NumOpcodes)
+      return ctx->ListExt.Opcode[i].Size;
+   return InstSize[n[0].opcode];
+}
+
+
+/**
+ * If the instruction at n just sets one piece of state, which nothing
+ * but another instruction setting that same piece of state can change,
+ * return GL_TRUE and identify that piece of state by an opcode and a
+ * target enum.  Executing such an instruction again with the same
+ * parameters has no effect.
+ */
+static GLboolean
+is_state_instruction(const Node *n, OpCode *opcode, GLenum *target)
+{
+   switch (n[0].opcode) {
+   case OPCODE_ENABLE:
+   case OPCODE_DISABLE:
+      *opcode = OPCODE_ENABLE;
+      *target = n[1].e;
+      return GL_TRUE;
+   case OPCODE_BIND_TEXTURE:
+      *opcode = OPCODE_BIND_TEXTURE;
+      *target = n[1].e;
+      return GL_TRUE;
+   case OPCODE_ALPHA_FUNC:
+   case OPCODE_BLEND_FUNC_SEPARATE:
+   case OPCODE_COLOR_MASK:
+   case OPCODE_CULL_FACE:
+   case OPCODE_DEPTH_FUNC:
+   case OPCODE_DEPTH_MASK:
+   case OPCODE_FRONT_FACE:
+   case OPCODE_LINE_STIPPLE:
+   case OPCODE_LINE_WIDTH:
+   case OPCODE_LOGIC_OP:
+   case OPCODE_POINT_SIZE:
+   case OPCODE_POLYGON_OFFSET:
+   case OPCODE_SHADE_MODEL:
+      *opcode = n[0].opcode;
+      *target = 0;
+      return GL_TRUE;
+   default:
+      return GL_FALSE;
+   }
+}
+
+
+/**
+ * Do the state instructions at a and b set the same state to the same
+ * value?
+ */
+static GLboolean
+same_state_instruction(const Node *a, const Node *b)
+{
+   GLuint i;
+
+   if (a[0].opcode != b[0].opcode)
+      return GL_FALSE;
+
+   switch (a[0].opcode) {
+   case OPCODE_COLOR_MASK:
+   case OPCODE_DEPTH_MASK:
+      for (i = 1; i < InstSize[a[0].opcode]; i++) {
+         if (a[i].b != b[i].b)
+            return GL_FALSE;
+      }
+      return GL_TRUE;
+   case OPCODE_LINE_STIPPLE:
+      return a[1].i == b[1].i && a[2].us == b[2].us;
+   default:
+      /* the other parameters are all 32-bit values; note that this
+       * compares floats bitwise
+       */
+      for (i = 1; i < InstSize[a[0].opcode]; i++) {
+         if (a[i].ui != b[i].ui)
+            return GL_FALSE;
+      }
+      return GL_TRUE;
+   }
+}
+
+
+/**
+ * Optimize a newly compiled display list, in place:
+ *  - State instructions (see is_state_instruction()) which set a piece
+ *    of state to the value an earlier instruction set it to are removed,
+ *    as long as nothing but state instructions and vertex data come in
+ *    between.  Applications often emit the same glEnable/glShadeModel/
+ *    glBindTexture/etc before each object they draw.
+ *  - Consecutive driver instructions (vertex lists) are merged into one
+ *    with the driver's Merge callback, if it has one.  Instructions with a
+ *    Merge callback must not change any state but the current attribs.
+ * The remaining instructions are moved down to fill the gaps and blocks
+ * which become unused are freed.
+ */
+static void
+optimize_list(GLcontext *ctx, struct mesa_display_list *dlist)
+{
+   struct {
+      OpCode opcode;
+      GLenum target;
+      const Node *n;  /**< the instruction which set it, in the new list */
+   } state[MAX_LIST_OPT_STATE];
+   GLuint numState = 0;
+   Node **blocks;
+   GLuint numBlocks = 1, rBlock = 0, wBlock = 0;
+   Node *r, *w, *last = NULL;
+
+   /* count the blocks */
+   for (r = dlist->node; r[0].opcode != OPCODE_END_OF_LIST; ) {
+      if (r[0].opcode == OPCODE_CONTINUE) {
+         r = (Node *) r[1].next;
+         numBlocks++;
+      }
+      else {
+         r += instruction_size(ctx, r);
+      }
+   }
+
+   blocks = (Node **) _mesa_malloc(numBlocks * sizeof(Node *));
+   if (!blocks)
+      return;  /* just don't optimize */
+   blocks[0] = dlist->node;
+
+   /* The write position never gets ahead of the read position, since each
+    * instruction was allocated in its block with the same limits used for
+    * writing here.
+    */
+   r = w = dlist->node;
+   while (r[0].opcode != OPCODE_END_OF_LIST) {
+      const OpCode opcode = r[0].opcode;
+      const GLint ext = (GLint) opcode - (GLint) OPCODE_EXT_0;
+      GLuint size, k = MAX_LIST_OPT_STATE;
+      OpCode stateOpcode;
+      GLenum target;
+
+      if (opcode == OPCODE_CONTINUE) {
+         r = (Node *) r[1].next;
+         blocks[++rBlock] = r;
+         continue;
+      }
+
+      size = instruction_size(ctx, r);
+
+      if (is_state_instruction(r, &stateOpcode, &target)) {
+         for (k = 0; k < numState; k++) {
+            if (state[k].opcode == stateOpcode && state[k].target == target)
+               break;
+         }
+         if (k < numState && same_state_instruction(state[k].n, r)) {
+            /* redundant, drop it */
+            r += size;
+            continue;
+         }
+         if (k == numState) {
+            if (numState == MAX_LIST_OPT_STATE)
+               numState = k = 0;
+            state[k].opcode = stateOpcode;
+            state[k].target = target;
+            numState++;
+         }
+      }
+      else if (ext >= 0 && ext < (GLint) ctx->ListExt.NumOpcodes &&
+               ctx->ListExt.Opcode[ext].Merge) {
+         if (last && last[0].opcode == opcode &&
+             ctx->ListExt.Opcode[ext].Merge(ctx, &last[1], &r[1])) {
+            ctx->ListExt.Opcode[ext].Destroy(ctx, &r[1]);
+            r += size;
+            continue;
+         }
+      }
+      else {
+         /* anything else may change or depend on any state */
+         numState = 0;
+      }
+
+      /* move the instruction to the write position */
+      if ((w - blocks[wBlock]) + size + 2 > BLOCK_SIZE) {
+         w[0].opcode = OPCODE_CONTINUE;
+         w[1].next = (void *) blocks[++wBlock];
+         w = blocks[wBlock];
+      }
+      if (w != r) {
+         /* w < r, so copying forwards is fine even if they overlap */
+         GLuint i;
+         for (i = 0; i < size; i++)
+            w[i] = r[i];
+      }
+      if (k < numState)
+         state[k].n = w;
+      last = w;
+      w += size;
+      r += size;
+   }
+
+   w[0].opcode = OPCODE_END_OF_LIST;
+
+   while (rBlock > wBlock)
+      _mesa_free(blocks[rBlock--]);
+
+   _mesa_free(blocks);
+}
+
+
 /**
  * End definition of current display list. 
  */
@@ -6803,6 +7025,8 @@ _mesa_EndList(void)
 
    (void) ALLOC_INSTRUCTION(ctx, OPCODE_END_OF_LIST, 0);
 
+   optimize_list(ctx, ctx->ListState.CurrentList);
+
    /* Destroy old list, if any */
    destroy_list(ctx, ctx->ListState.CurrentListNum);
    /* Install the list */
@@ -7623,6 +7847,28 @@ exec_MultiDrawElementsEXT(GLenum mode, const GLsizei * count,
                              (mode, count, type, indices, primcount));
 }
 
+/* GL_ARB_draw_instanced */
+static void GLAPIENTRY
+save_DrawArraysInstancedARB(GLenum mode, GLint first, GLsizei count,
+                            GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   (void) mode; (void) first; (void) count; (void) primcount;
+   _mesa_error(ctx, GL_INVALID_OPERATION,
+               "glDrawArraysInstancedARB() during display list compile");
+}
+
+/* GL_ARB_draw_instanced */
+static void GLAPIENTRY
+save_DrawElementsInstancedARB(GLenum mode, GLsizei count, GLenum type,
+                              const GLvoid *indices, GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   (void) mode; (void) count; (void) type; (void) indices; (void) primcount;
+   _mesa_error(ctx, GL_INVALID_OPERATION,
+               "glDrawElementsInstancedARB() during display list compile");
+}
+
 /* GL_IBM_multimode_draw_arrays */
 static void GLAPIENTRY
 exec_MultiModeDrawArraysIBM(const GLenum * mode, const GLint * first,
@@ -8174,6 +8420,11 @@ _mesa_init_dlist_table(struct _glapi_table *table)
 #endif
    SET_DrawBuffersARB(table, save_DrawBuffersARB);
 
+   /* ARB 49. GL_ARB_instanced_arrays */
+#if FEATURE_ARB_vertex_program
+   SET_VertexAttribDivisorARB(table, _mesa_VertexAttribDivisorARB);
+#endif
+
 #if FEATURE_EXT_framebuffer_blit
    SET_BlitFramebufferEXT(table, save_BlitFramebufferEXT);
 #endif
@@ -8552,6 +8803,14 @@ _mesa_save_vtxfmt_init(GLvertexformat * vfmt)
    vfmt->EvalMesh2 = _mesa_save_EvalMesh2;
    vfmt->Rectf = save_Rectf;
 
+   /* These are executed immediately, as with the dispatch table above */
+   vfmt->MultiDrawArraysEXT = exec_MultiDrawArraysEXT;
+   vfmt->MultiDrawElementsEXT = exec_MultiDrawElementsEXT;
+
+   /* GL_ARB_draw_instanced says these can't be compiled */
+   vfmt->DrawArraysInstancedARB = save_DrawArraysInstancedARB;
+   vfmt->DrawElementsInstancedARB = save_DrawElementsInstancedARB;
+
    /* The driver is required to implement these as
     * 1) They can probably do a better job.
     * 2) A lot of new mechanisms would have to be added to this module
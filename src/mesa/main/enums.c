@@ -1739,6 +1739,7 @@ LONGSTRING static const char enum_string_table[] =
    "GL_VERTEX_ATTRIB_ARRAY9_NV\0"
    "GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING\0"
    "GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING_ARB\0"
+   "GL_VERTEX_ATTRIB_ARRAY_DIVISOR_ARB\0"
    "GL_VERTEX_ATTRIB_ARRAY_ENABLED\0"
    "GL_VERTEX_ATTRIB_ARRAY_ENABLED_ARB\0"
    "GL_VERTEX_ATTRIB_ARRAY_NORMALIZED\0"
@@ -1785,7 +1786,7 @@ LONGSTRING static const char enum_string_table[] =
    "GL_ZOOM_Y\0"
    ;
 
-static const enum_elt all_enums[1748] =
+static const enum_elt all_enums[1749] =
 {
    {     0, 0x00000600 }, /* GL_2D */
    {     6, 0x00001407 }, /* GL_2_BYTES */
@@ -3491,53 +3492,54 @@ static const enum_elt all_enums[1748] =
    { 36428, 0x00008659 }, /* GL_VERTEX_ATTRIB_ARRAY9_NV */
    { 36455, 0x0000889F }, /* GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING */
    { 36493, 0x0000889F }, /* GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING_ARB */
-   { 36535, 0x00008622 }, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED */
-   { 36566, 0x00008622 }, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED_ARB */
-   { 36601, 0x0000886A }, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED */
-   { 36635, 0x0000886A }, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED_ARB */
-   { 36673, 0x00008645 }, /* GL_VERTEX_ATTRIB_ARRAY_POINTER */
-   { 36704, 0x00008645 }, /* GL_VERTEX_ATTRIB_ARRAY_POINTER_ARB */
-   { 36739, 0x00008623 }, /* GL_VERTEX_ATTRIB_ARRAY_SIZE */
-   { 36767, 0x00008623 }, /* GL_VERTEX_ATTRIB_ARRAY_SIZE_ARB */
-   { 36799, 0x00008624 }, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE */
-   { 36829, 0x00008624 }, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE_ARB */
-   { 36863, 0x00008625 }, /* GL_VERTEX_ATTRIB_ARRAY_TYPE */
-   { 36891, 0x00008625 }, /* GL_VERTEX_ATTRIB_ARRAY_TYPE_ARB */
-   { 36923, 0x000086A7 }, /* GL_VERTEX_BLEND_ARB */
-   { 36943, 0x00008620 }, /* GL_VERTEX_PROGRAM_ARB */
-   { 36965, 0x0000864A }, /* GL_VERTEX_PROGRAM_BINDING_NV */
-   { 36994, 0x00008620 }, /* GL_VERTEX_PROGRAM_NV */
-   { 37015, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE */
-   { 37044, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE_ARB */
-   { 37077, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE_NV */
-   { 37109, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE */
-   { 37136, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE_ARB */
-   { 37167, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE_NV */
-   { 37197, 0x00008B31 }, /* GL_VERTEX_SHADER */
-   { 37214, 0x00008B31 }, /* GL_VERTEX_SHADER_ARB */
-   { 37235, 0x00008621 }, /* GL_VERTEX_STATE_PROGRAM_NV */
-   { 37262, 0x00000BA2 }, /* GL_VIEWPORT */
-   { 37274, 0x00000800 }, /* GL_VIEWPORT_BIT */
-   { 37290, 0x000086AD }, /* GL_WEIGHT_ARRAY_ARB */
-   { 37310, 0x0000889E }, /* GL_WEIGHT_ARRAY_BUFFER_BINDING */
-   { 37341, 0x0000889E }, /* GL_WEIGHT_ARRAY_BUFFER_BINDING_ARB */
-   { 37376, 0x000086AC }, /* GL_WEIGHT_ARRAY_POINTER_ARB */
-   { 37404, 0x000086AB }, /* GL_WEIGHT_ARRAY_SIZE_ARB */
-   { 37429, 0x000086AA }, /* GL_WEIGHT_ARRAY_STRIDE_ARB */
-   { 37456, 0x000086A9 }, /* GL_WEIGHT_ARRAY_TYPE_ARB */
-   { 37481, 0x000086A6 }, /* GL_WEIGHT_SUM_UNITY_ARB */
-   { 37505, 0x000081D4 }, /* GL_WRAP_BORDER_SUN */
-   { 37524, 0x000088B9 }, /* GL_WRITE_ONLY */
-   { 37538, 0x000088B9 }, /* GL_WRITE_ONLY_ARB */
-   { 37556, 0x00001506 }, /* GL_XOR */
-   { 37563, 0x000085B9 }, /* GL_YCBCR_422_APPLE */
-   { 37582, 0x00008757 }, /* GL_YCBCR_MESA */
-   { 37596, 0x00000000 }, /* GL_ZERO */
-   { 37604, 0x00000D16 }, /* GL_ZOOM_X */
-   { 37614, 0x00000D17 }, /* GL_ZOOM_Y */
+   { 36535, 0x000088FE }, /* GL_VERTEX_ATTRIB_ARRAY_DIVISOR_ARB */
+   { 36570, 0x00008622 }, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED */
+   { 36601, 0x00008622 }, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED_ARB */
+   { 36636, 0x0000886A }, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED */
+   { 36670, 0x0000886A }, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED_ARB */
+   { 36708, 0x00008645 }, /* GL_VERTEX_ATTRIB_ARRAY_POINTER */
+   { 36739, 0x00008645 }, /* GL_VERTEX_ATTRIB_ARRAY_POINTER_ARB */
+   { 36774, 0x00008623 }, /* GL_VERTEX_ATTRIB_ARRAY_SIZE */
+   { 36802, 0x00008623 }, /* GL_VERTEX_ATTRIB_ARRAY_SIZE_ARB */
+   { 36834, 0x00008624 }, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE */
+   { 36864, 0x00008624 }, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE_ARB */
+   { 36898, 0x00008625 }, /* GL_VERTEX_ATTRIB_ARRAY_TYPE */
+   { 36926, 0x00008625 }, /* GL_VERTEX_ATTRIB_ARRAY_TYPE_ARB */
+   { 36958, 0x000086A7 }, /* GL_VERTEX_BLEND_ARB */
+   { 36978, 0x00008620 }, /* GL_VERTEX_PROGRAM_ARB */
+   { 37000, 0x0000864A }, /* GL_VERTEX_PROGRAM_BINDING_NV */
+   { 37029, 0x00008620 }, /* GL_VERTEX_PROGRAM_NV */
+   { 37050, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE */
+   { 37079, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE_ARB */
+   { 37112, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE_NV */
+   { 37144, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE */
+   { 37171, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE_ARB */
+   { 37202, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE_NV */
+   { 37232, 0x00008B31 }, /* GL_VERTEX_SHADER */
+   { 37249, 0x00008B31 }, /* GL_VERTEX_SHADER_ARB */
+   { 37270, 0x00008621 }, /* GL_VERTEX_STATE_PROGRAM_NV */
+   { 37297, 0x00000BA2 }, /* GL_VIEWPORT */
+   { 37309, 0x00000800 }, /* GL_VIEWPORT_BIT */
+   { 37325, 0x000086AD }, /* GL_WEIGHT_ARRAY_ARB */
+   { 37345, 0x0000889E }, /* GL_WEIGHT_ARRAY_BUFFER_BINDING */
+   { 37376, 0x0000889E }, /* GL_WEIGHT_ARRAY_BUFFER_BINDING_ARB */
+   { 37411, 0x000086AC }, /* GL_WEIGHT_ARRAY_POINTER_ARB */
+   { 37439, 0x000086AB }, /* GL_WEIGHT_ARRAY_SIZE_ARB */
+   { 37464, 0x000086AA }, /* GL_WEIGHT_ARRAY_STRIDE_ARB */
+   { 37491, 0x000086A9 }, /* GL_WEIGHT_ARRAY_TYPE_ARB */
+   { 37516, 0x000086A6 }, /* GL_WEIGHT_SUM_UNITY_ARB */
+   { 37540, 0x000081D4 }, /* GL_WRAP_BORDER_SUN */
+   { 37559, 0x000088B9 }, /* GL_WRITE_ONLY */
+   { 37573, 0x000088B9 }, /* GL_WRITE_ONLY_ARB */
+   { 37591, 0x00001506 }, /* GL_XOR */
+   { 37598, 0x000085B9 }, /* GL_YCBCR_422_APPLE */
+   { 37617, 0x00008757 }, /* GL_YCBCR_MESA */
+   { 37631, 0x00000000 }, /* GL_ZERO */
+   { 37639, 0x00000D16 }, /* GL_ZOOM_X */
+   { 37649, 0x00000D17 }, /* GL_ZOOM_Y */
 };
 
-static const unsigned reduced_enums[1284] =
+static const unsigned reduced_enums[1285] =
 {
        434, /* GL_FALSE */
        643, /* GL_LINES */
@@ -3679,7 +3681,7 @@ static const unsigned reduced_enums[1284] =
       1423, /* GL_STENCIL_WRITEMASK */
        789, /* GL_MATRIX_MODE */
        956, /* GL_NORMALIZE */
-      1729, /* GL_VIEWPORT */
+      1730, /* GL_VIEWPORT */
        930, /* GL_MODELVIEW_STACK_DEPTH */
       1189, /* GL_PROJECTION_STACK_DEPTH */
       1618, /* GL_TEXTURE_STACK_DEPTH */
@@ -3759,8 +3761,8 @@ static const unsigned reduced_enums[1284] =
        586, /* GL_INDEX_OFFSET */
       1233, /* GL_RED_SCALE */
       1231, /* GL_RED_BIAS */
-      1746, /* GL_ZOOM_X */
-      1747, /* GL_ZOOM_Y */
+      1747, /* GL_ZOOM_X */
+      1748, /* GL_ZOOM_Y */
        549, /* GL_GREEN_SCALE */
        547, /* GL_GREEN_BIAS */
         91, /* GL_BLUE_SCALE */
@@ -3861,7 +3863,7 @@ static const unsigned reduced_enums[1284] =
        268, /* GL_COPY */
         50, /* GL_AND_INVERTED */
        954, /* GL_NOOP */
-      1742, /* GL_XOR */
+      1743, /* GL_XOR */
       1016, /* GL_OR */
        955, /* GL_NOR */
        425, /* GL_EQUIV */
@@ -4200,7 +4202,7 @@ static const unsigned reduced_enums[1284] =
        273, /* GL_CULL_VERTEX_EXT */
        275, /* GL_CULL_VERTEX_OBJECT_POSITION_EXT */
        274, /* GL_CULL_VERTEX_EYE_POSITION_EXT */
-      1739, /* GL_WRAP_BORDER_SUN */
+      1740, /* GL_WRAP_BORDER_SUN */
       1537, /* GL_TEXTURE_COLOR_WRITEMASK_SGIS */
        632, /* GL_LIGHT_MODEL_COLOR_CONTROL */
       1343, /* GL_SINGLE_COLOR */
@@ -4355,18 +4357,18 @@ static const unsigned reduced_enums[1284] =
       1008, /* GL_OPERAND2_ALPHA */
       1014, /* GL_OPERAND3_ALPHA_NV */
       1679, /* GL_VERTEX_ARRAY_BINDING_APPLE */
-      1743, /* GL_YCBCR_422_APPLE */
+      1744, /* GL_YCBCR_422_APPLE */
       1668, /* GL_UNSIGNED_SHORT_8_8_APPLE */
       1670, /* GL_UNSIGNED_SHORT_8_8_REV_APPLE */
       1345, /* GL_SLICE_ACCUM_SUN */
       1210, /* GL_QUAD_MESH_SUN */
       1641, /* GL_TRIANGLE_MESH_SUN */
-      1717, /* GL_VERTEX_PROGRAM_ARB */
-      1728, /* GL_VERTEX_STATE_PROGRAM_NV */
-      1704, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED */
-      1710, /* GL_VERTEX_ATTRIB_ARRAY_SIZE */
-      1712, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE */
-      1714, /* GL_VERTEX_ATTRIB_ARRAY_TYPE */
+      1718, /* GL_VERTEX_PROGRAM_ARB */
+      1729, /* GL_VERTEX_STATE_PROGRAM_NV */
+      1705, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED */
+      1711, /* GL_VERTEX_ATTRIB_ARRAY_SIZE */
+      1713, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE */
+      1715, /* GL_VERTEX_ATTRIB_ARRAY_TYPE */
        300, /* GL_CURRENT_VERTEX_ATTRIB */
       1166, /* GL_PROGRAM_LENGTH_ARB */
       1180, /* GL_PROGRAM_STRING_ARB */
@@ -4387,15 +4389,15 @@ static const unsigned reduced_enums[1284] =
        781, /* GL_MATRIX7_NV */
        285, /* GL_CURRENT_MATRIX_STACK_DEPTH_ARB */
        282, /* GL_CURRENT_MATRIX_ARB */
-      1720, /* GL_VERTEX_PROGRAM_POINT_SIZE */
-      1723, /* GL_VERTEX_PROGRAM_TWO_SIDE */
+      1721, /* GL_VERTEX_PROGRAM_POINT_SIZE */
+      1724, /* GL_VERTEX_PROGRAM_TWO_SIDE */
       1178, /* GL_PROGRAM_PARAMETER_NV */
-      1708, /* GL_VERTEX_ATTRIB_ARRAY_POINTER */
+      1709, /* GL_VERTEX_ATTRIB_ARRAY_POINTER */
       1182, /* GL_PROGRAM_TARGET_NV */
       1179, /* GL_PROGRAM_RESIDENT_NV */
       1626, /* GL_TRACK_MATRIX_NV */
       1627, /* GL_TRACK_MATRIX_TRANSFORM_NV */
-      1718, /* GL_VERTEX_PROGRAM_BINDING_NV */
+      1719, /* GL_VERTEX_PROGRAM_BINDING_NV */
       1160, /* GL_PROGRAM_ERROR_POSITION_ARB */
        319, /* GL_DEPTH_CLAMP_NV */
       1686, /* GL_VERTEX_ATTRIB_ARRAY0_NV */
@@ -4452,14 +4454,14 @@ static const unsigned reduced_enums[1284] =
        239, /* GL_COMPRESSED_TEXTURE_FORMATS */
        877, /* GL_MAX_VERTEX_UNITS_ARB */
         22, /* GL_ACTIVE_VERTEX_UNITS_ARB */
-      1738, /* GL_WEIGHT_SUM_UNITY_ARB */
-      1716, /* GL_VERTEX_BLEND_ARB */
+      1739, /* GL_WEIGHT_SUM_UNITY_ARB */
+      1717, /* GL_VERTEX_BLEND_ARB */
        302, /* GL_CURRENT_WEIGHT_ARB */
-      1737, /* GL_WEIGHT_ARRAY_TYPE_ARB */
-      1736, /* GL_WEIGHT_ARRAY_STRIDE_ARB */
-      1735, /* GL_WEIGHT_ARRAY_SIZE_ARB */
-      1734, /* GL_WEIGHT_ARRAY_POINTER_ARB */
-      1731, /* GL_WEIGHT_ARRAY_ARB */
+      1738, /* GL_WEIGHT_ARRAY_TYPE_ARB */
+      1737, /* GL_WEIGHT_ARRAY_STRIDE_ARB */
+      1736, /* GL_WEIGHT_ARRAY_SIZE_ARB */
+      1735, /* GL_WEIGHT_ARRAY_POINTER_ARB */
+      1732, /* GL_WEIGHT_ARRAY_ARB */
        345, /* GL_DOT3_RGB */
        346, /* GL_DOT3_RGBA */
        237, /* GL_COMPRESSED_RGB_FXT1_3DFX */
@@ -4504,7 +4506,7 @@ static const unsigned reduced_enums[1284] =
        932, /* GL_MODULATE_ADD_ATI */
        933, /* GL_MODULATE_SIGNED_ADD_ATI */
        934, /* GL_MODULATE_SUBTRACT_ATI */
-      1744, /* GL_YCBCR_MESA */
+      1745, /* GL_YCBCR_MESA */
       1023, /* GL_PACK_INVERT_MESA */
        305, /* GL_DEBUG_OBJECT_MESA */
        306, /* GL_DEBUG_PRINT_MESA */
@@ -4569,7 +4571,7 @@ static const unsigned reduced_enums[1284] =
       1214, /* GL_QUERY_RESULT */
       1216, /* GL_QUERY_RESULT_AVAILABLE */
        871, /* GL_MAX_VERTEX_ATTRIBS */
-      1706, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED */
+      1707, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED */
        336, /* GL_DEPTH_STENCIL_TO_RGBA_NV */
        335, /* GL_DEPTH_STENCIL_TO_BGRA_NV */
        857, /* GL_MAX_TEXTURE_COORDS */
@@ -4592,7 +4594,7 @@ static const unsigned reduced_enums[1284] =
        415, /* GL_EDGE_FLAG_ARRAY_BUFFER_BINDING */
       1321, /* GL_SECONDARY_COLOR_ARRAY_BUFFER_BINDING */
        461, /* GL_FOG_COORDINATE_ARRAY_BUFFER_BINDING */
-      1732, /* GL_WEIGHT_ARRAY_BUFFER_BINDING */
+      1733, /* GL_WEIGHT_ARRAY_BUFFER_BINDING */
       1702, /* GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING */
       1165, /* GL_PROGRAM_INSTRUCTIONS_ARB */
        833, /* GL_MAX_PROGRAM_INSTRUCTIONS_ARB */
@@ -4619,7 +4621,7 @@ static const unsigned reduced_enums[1284] =
       1186, /* GL_PROGRAM_UNDER_NATIVE_LIMITS_ARB */
       1631, /* GL_TRANSPOSE_CURRENT_MATRIX_ARB */
       1224, /* GL_READ_ONLY */
-      1740, /* GL_WRITE_ONLY */
+      1741, /* GL_WRITE_ONLY */
       1226, /* GL_READ_WRITE */
        100, /* GL_BUFFER_ACCESS */
        102, /* GL_BUFFER_MAPPED */
@@ -4675,13 +4677,14 @@ static const unsigned reduced_enums[1284] =
        832, /* GL_MAX_PROGRAM_IF_DEPTH_NV */
        836, /* GL_MAX_PROGRAM_LOOP_DEPTH_NV */
        835, /* GL_MAX_PROGRAM_LOOP_COUNT_NV */
+      1704, /* GL_VERTEX_ATTRIB_ARRAY_DIVISOR_ARB */
        793, /* GL_MAX_ARRAY_TEXTURE_LAYERS_EXT */
       1421, /* GL_STENCIL_TEST_TWO_SIDE_EXT */
         17, /* GL_ACTIVE_STENCIL_FACE_EXT */
        892, /* GL_MIRROR_CLAMP_TO_BORDER_EXT */
       1302, /* GL_SAMPLES_PASSED */
        484, /* GL_FRAGMENT_SHADER */
-      1726, /* GL_VERTEX_SHADER */
+      1727, /* GL_VERTEX_SHADER */
       1176, /* GL_PROGRAM_OBJECT_ARB */
       1334, /* GL_SHADER_OBJECT_ARB */
        817, /* GL_MAX_FRAGMENT_UNIFORM_COMPONENTS */
@@ -1705,7 +1705,8 @@ create_new_program( const struct state_key *key,
 
 /**
  * Return a vertex program which implements the current fixed-function
- * transform/lighting/texgen operations.
+ * transform/lighting/texgen operations.  The caller gets a reference
+ * to the program, which it must release.
  * XXX move this into core mesa (main/)
  */
 struct gl_vertex_program *
@@ -1721,7 +1722,7 @@ _mesa_get_fixed_func_vertex_program(GLcontext *ctx)
    /* Look for an already-prepared program for this state:
     */
    prog = (struct gl_vertex_program *)
-      _mesa_search_program_cache(ctx->VertexProgram.Cache, &key, sizeof(key));
+      _mesa_search_program_cache(ctx->Shared->VertexProgramCache, &key, sizeof(key));
    
    if (!prog) {
       /* OK, we'll have to build a new one */
@@ -1741,7 +1742,7 @@ _mesa_get_fixed_func_vertex_program(GLcontext *ctx)
          ctx->Driver.ProgramStringNotify( ctx, GL_VERTEX_PROGRAM_ARB, 
                                           &prog->Base );
 #endif
-      _mesa_program_cache_insert(ctx, ctx->VertexProgram.Cache,
+      _mesa_program_cache_insert(ctx, ctx->Shared->VertexProgramCache,
                                  &key, sizeof(key), &prog->Base);
    }
 
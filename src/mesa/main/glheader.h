@@ -180,6 +180,12 @@
 #endif
 
 
+/* glext.h has the GL_ARB_instanced_arrays section, but not its enum */
+#ifndef GL_VERTEX_ATTRIB_ARRAY_DIVISOR_ARB
+#define GL_VERTEX_ATTRIB_ARRAY_DIVISOR_ARB  0x88FE
+#endif
+
+
 #if !defined(CAPI) && defined(WIN32) && !defined(BUILD_FOR_SNAP)
 #define CAPI _cdecl
 #endif
@@ -248,6 +248,17 @@ _mesa_memcpy(void *dest, const void *src, size_t n)
 #endif
 }
 
+/** memmove wrapper, for overlapping regions */
+void *
+_mesa_memmove(void *dest, const void *src, size_t n)
+{
+#if defined(SUNOS4)
+   return memmove((char *) dest, (char *) src, (int) n);
+#else
+   return memmove(dest, src, n);
+#endif
+}
+
 /** Wrapper around memset() */
 void
 _mesa_memset( void *dst, int val, size_t n )
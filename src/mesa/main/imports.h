@@ -655,6 +655,9 @@ _mesa_realloc( void *oldBuffer, size_t oldSize, size_t newSize );
 extern void *
 _mesa_memcpy( void *dest, const void *src, size_t n );
 
+extern void *
+_mesa_memmove( void *dest, const void *src, size_t n );
+
 extern void
 _mesa_memset( void *dst, int val, size_t n );
 
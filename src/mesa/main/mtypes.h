@@ -939,6 +939,12 @@ struct gl_list_instruction
    void (*Execute)( GLcontext *ctx, void *data );
    void (*Destroy)( GLcontext *ctx, void *data );
    void (*Print)( GLcontext *ctx, void *data );
+   /**
+    * Optional.  Try to append the instruction at 'next', which immediately
+    * follows the one at 'data', to the instruction at 'data'.  Returns
+    * GL_TRUE if it did; 'next' is then destroyed and dropped from the list.
+    */
+   GLboolean (*Merge)( GLcontext *ctx, void *data, void *next );
 };
 
 #define MAX_DLIST_EXT_OPCODES 16
@@ -1371,6 +1377,8 @@ struct gl_texture_image
    GLuint *ImageOffsets;        /**< if 3D texture: array [Depth] of offsets to
                                      each 2D slice in 'Data', in texels */
    GLvoid *Data;		/**< Image data, accessed via FetchTexel() */
+   GLuint Stamp;		/**< new value whenever Data changes, see
+                                 *   _mesa_touch_texture_image() */
 
    /**
     * \name For device driver:
@@ -1631,6 +1639,7 @@ struct gl_buffer_object
    GLsizeiptrARB Size;       /**< Size of storage in bytes */
    GLubyte *Data;            /**< Location of storage either in RAM or VRAM. */
    GLboolean OnCard;         /**< Is buffer in VRAM? (hardware drivers) */
+   GLuint Stamp;             /**< Incremented when Data may have changed */
 };
 
 
@@ -1667,6 +1676,7 @@ struct gl_client_array
    const GLubyte *Ptr;          /**< Points to array data */
    GLboolean Enabled;		/**< Enabled flag is a boolean */
    GLboolean Normalized;        /**< GL_ARB_vertex_program */
+   GLuint Divisor;              /**< GL_ARB_instanced_arrays */
 
    /**< GL_ARB_vertex_buffer_object */
    struct gl_buffer_object *BufferObj;
@@ -1724,6 +1734,9 @@ struct gl_array_attrib
    struct gl_buffer_object *ElementArrayBufferObj;
 #endif
    GLuint _MaxElement;          /* Min of all enabled array's maxes */
+
+   /** Instance being drawn by glDraw*InstancedARB, else zero */
+   GLint InstanceID;
 };
 
 
@@ -1862,6 +1875,7 @@ struct gl_uniform_list;
  */
 struct gl_program
 {
+   _glthread_Mutex Mutex;  /**< for thread safety */
    GLuint Id;
    GLubyte *String;  /**< Null-terminated program text */
    GLint RefCount;
@@ -1977,9 +1991,6 @@ struct gl_vertex_program_state
    /** Program to emulate fixed-function T&L (see above) */
    struct gl_vertex_program *_TnlProgram;
 
-   /** Cache of fixed-function programs */
-   struct gl_program_cache *Cache;
-
 #if FEATURE_MESA_program_debug
    GLprogramcallbackMESA Callback;
    GLvoid *CallbackData;
@@ -2013,9 +2024,6 @@ struct gl_fragment_program_state
    /** Program to emulate fixed-function texture env/combine (see above) */
    struct gl_fragment_program *_TexEnvProgram;
 
-   /** Cache of fixed-function programs */
-   struct gl_program_cache *Cache;
-
 #if FEATURE_MESA_program_debug
    GLprogramcallbackMESA Callback;
    GLvoid *CallbackData;
@@ -2199,6 +2207,9 @@ struct gl_shared_state
 #if FEATURE_ARB_fragment_program
    struct gl_fragment_program *DefaultFragmentProgram;
 #endif
+   /** Programs generated from fixed-function state (see prog_cache.c) */
+   struct gl_program_cache *VertexProgramCache;
+   struct gl_program_cache *FragmentProgramCache;
    /*@}*/
 
 #if FEATURE_ATI_fragment_shader
@@ -2501,6 +2512,11 @@ struct gl_constants
    /* GL_ARB_vertex_shader */
    GLuint MaxVertexTextureImageUnits;
    GLuint MaxVarying;  /**< Number of float[4] vectors */
+   /**
+    * Store generic GL_RGB/GL_RGBA 2D texture images with at least this
+    * many texels in a compressed format (0 = never).
+    */
+   GLuint CompressTexturesMinTexels;
 };
 
 
@@ -2519,11 +2535,13 @@ struct gl_extensions
    GLboolean dummy;  /* don't remove this! */
    GLboolean ARB_depth_texture;
    GLboolean ARB_draw_buffers;
+   GLboolean ARB_draw_instanced;
    GLboolean ARB_fragment_program;
    GLboolean ARB_fragment_program_shadow;
    GLboolean ARB_fragment_shader;
    GLboolean ARB_half_float_pixel;
    GLboolean ARB_imaging;
+   GLboolean ARB_instanced_arrays;
    GLboolean ARB_multisample;
    GLboolean ARB_multitexture;
    GLboolean ARB_occlusion_query;
@@ -3046,6 +3064,18 @@ struct __GLcontextRec
    GLenum RenderMode;        /**< either GL_RENDER, GL_SELECT, GL_FEEDBACK */
    GLbitfield NewState;      /**< bitwise-or of _NEW_* flags */
 
+   /**
+    * Serial numbers used to tell whether state has changed since some
+    * derived value was computed (see _mesa_load_state_parameters()).
+    * _StateSerial is bumped by each _mesa_update_state() that sees new
+    * state; _StateBitSerial[i] is the value of _StateSerial at the last
+    * update which included flag bit (1 << i).
+    */
+   /*@{*/
+   GLuint _StateSerial;
+   GLuint _StateBitSerial[32];
+   /*@}*/
+
    /** \name Derived state */
    /*@{*/
    /** Bitwise-or of DD_* flags.  Note that this bitfield may be used before
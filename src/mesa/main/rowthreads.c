@@ -0,0 +1,178 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  7.3
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/**
+ * \file rowthreads.c
+ * Split image processing jobs by rows over several threads.
+ *
+ * Used for jobs whose rows are independent of each other, such as FXT1
+ * encoding, so the result doesn't depend on the number of threads.
+ */
+
+
+#include "glheader.h"
+#include "imports.h"
+#include "macros.h"
+#include "rowthreads.h"
+
+#ifdef PTHREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+
+#ifdef PTHREADS
+
+/**
+ * Most threads any job may use, from the MESA_THREADS environment
+ * variable; -1 until it has been read.
+ */
+static GLint max_row_threads = -1;
+
+
+/**
+ * Read MESA_THREADS.  Unset means no threading; 0 means one thread per
+ * online CPU.
+ */
+static GLint
+get_max_row_threads(void)
+{
+   const char *env = _mesa_getenv("MESA_THREADS");
+   GLint n = 1;
+
+   if (env) {
+      n = _mesa_atoi(env);
+#ifdef _SC_NPROCESSORS_ONLN
+      if (n == 0)
+         n = (GLint) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+   }
+
+   return CLAMP(n, 1, MAX_ROW_THREADS);
+}
+
+#endif /* PTHREADS */
+
+
+/**
+ * How many threads to split a job of the given number of rows and
+ * amount of work over.  Jobs aren't threaded unless the MESA_THREADS
+ * environment variable allows it; it is read on the first call only.
+ * Every thread gets at least minWorkPerThread, in the same units as
+ * 'work'.  Always 1 without thread support.
+ */
+GLuint
+_mesa_num_row_threads(GLint rows, GLfloat work, GLfloat minWorkPerThread)
+{
+#ifdef PTHREADS
+   GLint n;
+
+   /* Every caller computes the same value, so a race here is harmless */
+   if (max_row_threads < 0)
+      max_row_threads = get_max_row_threads();
+
+   n = max_row_threads;
+   if (n == 1)
+      return 1;
+
+   n = MIN2(n, (GLint) (work / minWorkPerThread));
+   n = MIN2(n, rows);
+   return n > 1 ? n : 1;
+#else
+   (void) rows;
+   (void) work;
+   (void) minWorkPerThread;
+   return 1;
+#endif
+}
+
+
+#ifdef PTHREADS
+
+struct row_share
+{
+   row_thread_func func;
+   void *data;
+   GLuint thread;
+   GLint y0, y1;
+};
+
+
+static void *
+row_thread(void *arg)
+{
+   const struct row_share *share = (const struct row_share *) arg;
+   share->func(share->data, share->thread, share->y0, share->y1);
+   return NULL;
+}
+
+#endif /* PTHREADS */
+
+
+/**
+ * Call func() for rows [y0, y1), split into numThreads shares of about
+ * the same size which run concurrently.  The calling thread does the
+ * first share itself, as well as the shares of any threads which
+ * couldn't be created, and returns once all shares are done.
+ */
+void
+_mesa_run_row_threads(GLuint numThreads, GLint y0, GLint y1,
+                      row_thread_func func, void *data)
+{
+#ifdef PTHREADS
+   if (numThreads > 1) {
+      struct row_share share[MAX_ROW_THREADS];
+      pthread_t thread[MAX_ROW_THREADS];
+      const GLint rows = y1 - y0;
+      GLuint i, started;
+
+      numThreads = MIN2(numThreads, MAX_ROW_THREADS);
+
+      for (i = 0; i < numThreads; i++) {
+         share[i].func = func;
+         share[i].data = data;
+         share[i].thread = i;
+         share[i].y0 = y0 + rows * i / numThreads;
+         share[i].y1 = y0 + rows * (i + 1) / numThreads;
+      }
+
+      for (started = 1; started < numThreads; started++) {
+         if (pthread_create(&thread[started], NULL,
+                            row_thread, &share[started]) != 0)
+            break;
+      }
+
+      row_thread(&share[0]);
+      for (i = started; i < numThreads; i++)
+         row_thread(&share[i]);
+
+      for (i = 1; i < started; i++)
+         pthread_join(thread[i], NULL);
+      return;
+   }
+#else
+   (void) numThreads;
+#endif
+
+   func(data, 0, y0, y1);
+}
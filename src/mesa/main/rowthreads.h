@@ -0,0 +1,51 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  7.3
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef ROWTHREADS_H
+#define ROWTHREADS_H
+
+
+#include "mtypes.h"
+
+
+/** Most threads a job is ever split into */
+#define MAX_ROW_THREADS 16
+
+
+/**
+ * Process rows [y0, y1) of a job.  'thread' is the index of the share,
+ * in [0, numThreads), for jobs which keep per-thread scratch space.
+ */
+typedef void (*row_thread_func)(void *data, GLuint thread,
+                                GLint y0, GLint y1);
+
+
+extern GLuint
+_mesa_num_row_threads(GLint rows, GLfloat work, GLfloat minWorkPerThread);
+
+extern void
+_mesa_run_row_threads(GLuint numThreads, GLint y0, GLint y1,
+                      row_thread_func func, void *data);
+
+
+#endif /* ROWTHREADS_H */
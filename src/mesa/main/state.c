@@ -158,7 +158,9 @@ update_arrays( GLcontext *ctx )
    /* 16..31 */
    if (ctx->VertexProgram._Current) {
       for (i = VERT_ATTRIB_GENERIC0; i < VERT_ATTRIB_MAX; i++) {
-         if (ctx->Array.ArrayObj->VertexAttrib[i].Enabled) {
+         /* instanced arrays are indexed by instance, not by vertex */
+         if (ctx->Array.ArrayObj->VertexAttrib[i].Enabled &&
+             !ctx->Array.ArrayObj->VertexAttrib[i].Divisor) {
             min = MIN2(min, ctx->Array.ArrayObj->VertexAttrib[i]._MaxElement);
          }
       }
@@ -225,10 +227,12 @@ update_program(GLcontext *ctx)
       else if (ctx->FragmentProgram._MaintainTexEnvProgram) {
          /* Use fragment program generated from fixed-function state.
           */
-         _mesa_reference_fragprog(ctx, &ctx->FragmentProgram._Current,
-                                  _mesa_get_fixed_func_fragment_program(ctx));
+         struct gl_fragment_program *f =
+            _mesa_get_fixed_func_fragment_program(ctx);
+         _mesa_reference_fragprog(ctx, &ctx->FragmentProgram._Current, f);
          _mesa_reference_fragprog(ctx, &ctx->FragmentProgram._TexEnvProgram,
-                                  ctx->FragmentProgram._Current);
+                                  f);
+         _mesa_reference_fragprog(ctx, &f, NULL);
       }
       else {
          /* no fragment program */
@@ -247,10 +251,11 @@ update_program(GLcontext *ctx)
       else if (ctx->VertexProgram._MaintainTnlProgram) {
          /* Use vertex program generated from fixed-function state.
           */
-         _mesa_reference_vertprog(ctx, &ctx->VertexProgram._Current,
-                                  _mesa_get_fixed_func_vertex_program(ctx));
-         _mesa_reference_vertprog(ctx, &ctx->VertexProgram._TnlProgram,
-                                  ctx->VertexProgram._Current);
+         struct gl_vertex_program *v =
+            _mesa_get_fixed_func_vertex_program(ctx);
+         _mesa_reference_vertprog(ctx, &ctx->VertexProgram._Current, v);
+         _mesa_reference_vertprog(ctx, &ctx->VertexProgram._TnlProgram, v);
+         _mesa_reference_vertprog(ctx, &v, NULL);
       }
       else {
          /* no vertex program */
@@ -423,6 +428,27 @@ update_tricaps(GLcontext *ctx, GLbitfield new_state)
 #endif
 
 
+/**
+ * Record that the state groups in new_state changed with this update.
+ * Consumers compare ctx->_StateBitSerial[] against the serial at which
+ * they last computed something to find out what has become stale.
+ */
+static void
+update_state_serials(GLcontext *ctx, GLbitfield new_state)
+{
+   GLuint i;
+
+   if (!new_state)
+      return;
+
+   ctx->_StateSerial++;
+   for (i = 0; new_state; i++, new_state >>= 1) {
+      if (new_state & 1)
+         ctx->_StateBitSerial[i] = ctx->_StateSerial;
+   }
+}
+
+
 /**
  * Compute derived GL state.
  * If __GLcontextRec::NewState is non-zero then this function \b must
@@ -528,6 +554,7 @@ _mesa_update_state_locked( GLcontext *ctx )
     */
    new_state = ctx->NewState;
    ctx->NewState = 0;
+   update_state_serials( ctx, new_state );
    ctx->Driver.UpdateState(ctx, new_state);
    ctx->Array.NewState = 0;
 }
@@ -40,6 +40,12 @@
 #include "texstore.h"
 
 
+/* in texcompress_fxt1.c */
+void
+fxt1_decode_block(const void *texture, GLint stride,
+                  GLint i, GLint j, GLchan rgba[][4]);
+
+
 /**
  * Return list of (and count of) all specific texture compression
  * formats that are supported.
@@ -312,3 +318,144 @@ _mesa_compressed_image_address(GLint col, GLint row, GLint img,
 
    return addr;
 }
+
+
+/**
+ * Return the width and height of the tiles a compressed format is made of.
+ * \param mesaFormat  one of the MESA_FORMAT_* compressed formats
+ */
+void
+_mesa_compressed_block_size(GLuint mesaFormat, GLuint *bw, GLuint *bh)
+{
+   switch (mesaFormat) {
+   case MESA_FORMAT_RGB_FXT1:
+   case MESA_FORMAT_RGBA_FXT1:
+      *bw = 8;
+      *bh = 4;
+      break;
+   default:
+      /* all the S3TC formats */
+      *bw = 4;
+      *bh = 4;
+   }
+}
+
+
+/**
+ * Is the given internal format one of the generic RGB/RGBA formats
+ * which we may silently store compressed?
+ */
+static GLboolean
+is_generic_color_format(GLint internalFormat)
+{
+   switch (internalFormat) {
+   case 3:
+   case GL_RGB:
+   case 4:
+   case GL_RGBA:
+      return GL_TRUE;
+   default:
+      return GL_FALSE;
+   }
+}
+
+
+/**
+ * Implements the "compress on upload" option (see
+ * gl_constants::CompressTexturesMinTexels): if the user asked for a
+ * generic RGB/RGBA internal format for a large enough 2D image, choose
+ * an in-tree compressed format to store it in instead.  This trades a
+ * little image quality for 4x to 8x less texture memory.
+ *
+ * \param dims  texture image dimensions (1, 2 or 3)
+ * \return compressed texture format, or NULL to keep the driver's choice
+ */
+const struct gl_texture_format *
+_mesa_choose_upload_compression(GLcontext *ctx,
+                                const struct gl_texture_image *texImage,
+                                GLuint dims, GLint internalFormat)
+{
+   const GLuint minTexels = ctx->Const.CompressTexturesMinTexels;
+   GLenum target;
+
+   if (minTexels == 0 ||
+       dims != 2 ||
+       texImage->Border != 0 ||
+       !is_generic_color_format(internalFormat) ||
+       texImage->Width * texImage->Height < minTexels)
+      return NULL;
+
+   target = texImage->TexObject ? texImage->TexObject->Target : GL_TEXTURE_2D;
+   if (target != GL_TEXTURE_2D && target != GL_TEXTURE_CUBE_MAP_ARB)
+      return NULL;
+
+#if FEATURE_texture_s3tc
+   /* DXT has better quality, but needs the external libtxc_dxtn */
+   if (ctx->Mesa_DXTn) {
+      if (texImage->_BaseFormat == GL_RGB)
+         return &_mesa_texformat_rgb_dxt1;
+      else
+         return &_mesa_texformat_rgba_dxt5;
+   }
+#endif
+#if FEATURE_texture_fxt1
+   if (texImage->_BaseFormat == GL_RGB)
+      return &_mesa_texformat_rgb_fxt1;
+   else
+      return &_mesa_texformat_rgba_fxt1;
+#else
+   return NULL;
+#endif
+}
+
+
+/**
+ * Was the texture image stored compressed by the "compress on upload"
+ * option, rather than because the user asked for a compressed format?
+ * Such images must keep behaving like uncompressed ones, in particular
+ * for sub-image updates which aren't aligned to the compressed tiles.
+ */
+GLboolean
+_mesa_is_upload_compressed(const struct gl_texture_image *texImage)
+{
+   return texImage->IsCompressed &&
+          is_generic_color_format(texImage->InternalFormat);
+}
+
+
+/**
+ * Decompress the whole tile containing texel (i, j) of a compressed
+ * 2D texture image.  The texels are returned row by row; see
+ * _mesa_compressed_block_size() for the tile dimensions.
+ */
+void
+_mesa_decompress_block(const struct gl_texture_image *texImage,
+                       GLint i, GLint j, GLchan texels[][4])
+{
+   GLuint bw, bh, x, y;
+   GLint i0, j0;
+
+#if FEATURE_texture_fxt1
+   if (texImage->TexFormat->MesaFormat == MESA_FORMAT_RGB_FXT1 ||
+       texImage->TexFormat->MesaFormat == MESA_FORMAT_RGBA_FXT1) {
+      fxt1_decode_block(texImage->Data, texImage->RowStride, i, j, texels);
+      if (texImage->TexFormat->MesaFormat == MESA_FORMAT_RGB_FXT1) {
+         /* some block modes encode transparent texels; RGB has no alpha */
+         for (x = 0; x < 32; x++)
+            texels[x][ACOMP] = CHAN_MAX;
+      }
+      return;
+   }
+#endif
+
+   /* the S3TC library only provides a per-texel decoder */
+   _mesa_compressed_block_size(texImage->TexFormat->MesaFormat, &bw, &bh);
+   i0 = i / bw * bw;
+   j0 = j / bh * bh;
+   for (y = 0; y < bh; y++) {
+      for (x = 0; x < bw; x++) {
+         texImage->FetchTexelc(texImage, i0 + x, j0 + y, 0,
+                               texels[y * bw + x]);
+      }
+   }
+}
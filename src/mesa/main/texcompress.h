@@ -52,6 +52,22 @@ _mesa_compressed_image_address(GLint col, GLint row, GLint img,
                                GLsizei width, const GLubyte *image);
 
 
+extern void
+_mesa_compressed_block_size(GLuint mesaFormat, GLuint *bw, GLuint *bh);
+
+extern const struct gl_texture_format *
+_mesa_choose_upload_compression(GLcontext *ctx,
+                                const struct gl_texture_image *texImage,
+                                GLuint dims, GLint internalFormat);
+
+extern GLboolean
+_mesa_is_upload_compressed(const struct gl_texture_image *texImage);
+
+extern void
+_mesa_decompress_block(const struct gl_texture_image *texImage,
+                       GLint i, GLint j, GLchan texels[][4]);
+
+
 extern void
 _mesa_init_texture_s3tc( GLcontext *ctx );
 
@@ -68,6 +84,8 @@ _mesa_init_texture_fxt1( GLcontext *ctx );
 #define _mesa_compressed_row_stride( f, w) 0
 #define _mesa_compressed_image_address(c, r, i, f, w, i2 ) 0
 #define _mesa_compress_teximage( c, w, h, sF, s, sRS, dF, d, drs ) ((void)0)
+#define _mesa_choose_upload_compression( c, t, d, f ) NULL
+#define _mesa_is_upload_compressed( t ) GL_FALSE
 
 #endif /* _HAVE_FULL_GL */
 
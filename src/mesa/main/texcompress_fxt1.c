@@ -36,6 +36,7 @@
 #include "convolve.h"
 #include "image.h"
 #include "mipmap.h"
+#include "rowthreads.h"
 #include "texcompress.h"
 #include "texformat.h"
 #include "texstore.h"
@@ -50,6 +51,18 @@ void
 fxt1_decode_1 (const void *texture, GLint stride,
                GLint i, GLint j, GLchan *rgba);
 
+void
+fxt1_decode_block (const void *texture, GLint stride,
+                   GLint i, GLint j, GLchan rgba[][4]);
+
+
+/**
+ * Compute the lerp indices one texel at a time, the way the encoder
+ * originally did, instead of with the vectorizable loops.  Set from the
+ * MESA_FXT1_SCALAR env var.
+ */
+static GLboolean fxt1_scalar = GL_FALSE;
+
 
 /**
  * Called during context initialization.
@@ -58,6 +71,7 @@ void
 _mesa_init_texture_fxt1( GLcontext *ctx )
 {
    (void) ctx;
+   fxt1_scalar = (_mesa_getenv("MESA_FXT1_SCALAR") != NULL);
 }
 
 
@@ -373,6 +387,54 @@ typedef struct {
    } while (0)
 
 
+/**
+ * Compute the lerp index of each texel of a 4x4 microtile, like CALCCDOT.
+ * The loop runs across texels (rather than across components, as
+ * CALCCDOT does) so that the compiler can vectorize it.  Each index is
+ * computed with the same arithmetic as CALCCDOT.  fxt1_scalar selects
+ * the original CALCCDOT loop instead, to check that a compiler's floating
+ * point optimizations (-ffast-math) round both the same way.
+ */
+static void
+fxt1_lerp_indices (GLint texel[N_TEXELS / 2],
+                   GLubyte input[N_TEXELS / 2][MAX_COMP],
+                   GLint nv, GLint nc, const GLfloat iv[MAX_COMP], GLfloat b)
+{
+   GLint i, k;
+
+   if (fxt1_scalar) {
+      for (k = 0; k < N_TEXELS / 2; k++) {
+         CALCCDOT(texel[k], nv, nc, iv, b, input[k]);
+      }
+   }
+   else if (nc == 4) {
+      for (k = 0; k < N_TEXELS / 2; k++) {
+         GLfloat dot = 0.0F;
+         GLint t;
+         dot += input[k][0] * iv[0];
+         dot += input[k][1] * iv[1];
+         dot += input[k][2] * iv[2];
+         dot += input[k][3] * iv[3];
+         t = (GLint)(dot + b);
+         t = t < 0 ? 0 : t;
+         texel[k] = t > nv ? nv : t;
+      }
+   }
+   else {
+      for (k = 0; k < N_TEXELS / 2; k++) {
+         GLfloat dot = 0.0F;
+         GLint t;
+         dot += input[k][0] * iv[0];
+         dot += input[k][1] * iv[1];
+         dot += input[k][2] * iv[2];
+         t = (GLint)(dot + b);
+         t = t < 0 ? 0 : t;
+         texel[k] = t > nv ? nv : t;
+      }
+   }
+}
+
+
 static GLint
 fxt1_bestcol (GLfloat vec[][MAX_COMP], GLint nv,
               GLubyte input[MAX_COMP], GLint nc)
@@ -743,6 +805,7 @@ fxt1_quantize_ALPHA1 (GLuint *cc,
    const GLint n_comp = 4; /* 4 components: R, G, B, A */
    GLfloat vec[1 + 1 + 1][MAX_COMP]; /* 1.5 extrema for each sub-block */
    GLfloat b, iv[MAX_COMP]; /* interpolation vector */
+   GLint texel[N_TEXELS / 2]; /* lerp index of each microtile texel */
    GLint i, j, k;
    Fx64 hi; /* high quadword */
    GLuint lohi, lolo; /* low quadword: hi dword, lo dword */
@@ -842,14 +905,11 @@ fxt1_quantize_ALPHA1 (GLuint *cc,
       MAKEIVEC(n_vect, n_comp, iv, b, vec[0], vec[1]);
 
       /* add in texels */
+      fxt1_lerp_indices(texel, input, n_vect, n_comp, iv, b);
       lolo = 0;
       for (k = N_TEXELS / 2 - 1; k >= 0; k--) {
-         GLint texel;
-         /* interpolate color */
-         CALCCDOT(texel, n_vect, n_comp, iv, b, input[k]);
-         /* add in texel */
          lolo <<= 2;
-         lolo |= texel;
+         lolo |= texel[k];
       }
       
       cc[0] = lolo;
@@ -862,14 +922,11 @@ fxt1_quantize_ALPHA1 (GLuint *cc,
       MAKEIVEC(n_vect, n_comp, iv, b, vec[2], vec[1]);
 
       /* add in texels */
+      fxt1_lerp_indices(texel, &input[N_TEXELS / 2], n_vect, n_comp, iv, b);
       lohi = 0;
-      for (k = N_TEXELS - 1; k >= N_TEXELS / 2; k--) {
-         GLint texel;
-         /* interpolate color */
-         CALCCDOT(texel, n_vect, n_comp, iv, b, input[k]);
-         /* add in texel */
+      for (k = N_TEXELS / 2 - 1; k >= 0; k--) {
          lohi <<= 2;
-         lohi |= texel;
+         lohi |= texel[k];
       }
 
       cc[1] = lohi;
@@ -976,6 +1033,7 @@ fxt1_quantize_MIXED1 (GLuint *cc,
    const GLint n_comp = 3; /* 3 components: R, G, B */
    GLubyte vec[2 * 2][MAX_COMP]; /* 2 extrema for each sub-block */
    GLfloat b, iv[MAX_COMP]; /* interpolation vector */
+   GLint texel[N_TEXELS / 2]; /* lerp index of each microtile texel */
    GLint i, j, k;
    Fx64 hi; /* high quadword */
    GLuint lohi, lolo; /* low quadword: hi dword, lo dword */
@@ -1045,16 +1103,14 @@ fxt1_quantize_MIXED1 (GLuint *cc,
          MAKEIVEC(n_vect, n_comp, iv, b, vec[0], vec[1]);
 
          /* add in texels */
+         fxt1_lerp_indices(texel, input, n_vect, n_comp, iv, b);
          lolo = 0;
          for (k = N_TEXELS / 2 - 1; k >= 0; k--) {
-            GLint texel = n_vect + 1; /* transparent black */
-            if (!ISTBLACK(input[k])) {
-               /* interpolate color */
-               CALCCDOT(texel, n_vect, n_comp, iv, b, input[k]);
-            }
-            /* add in texel */
             lolo <<= 2;
-            lolo |= texel;
+            if (ISTBLACK(input[k]))
+               lolo |= n_vect + 1; /* transparent black */
+            else
+               lolo |= texel[k];
          }
          cc[0] = lolo;
       }
@@ -1079,16 +1135,14 @@ fxt1_quantize_MIXED1 (GLuint *cc,
          MAKEIVEC(n_vect, n_comp, iv, b, vec[2], vec[3]);
 
          /* add in texels */
+         fxt1_lerp_indices(texel, &input[N_TEXELS / 2], n_vect, n_comp, iv, b);
          lohi = 0;
-         for (k = N_TEXELS - 1; k >= N_TEXELS / 2; k--) {
-            GLint texel = n_vect + 1; /* transparent black */
-            if (!ISTBLACK(input[k])) {
-               /* interpolate color */
-               CALCCDOT(texel, n_vect, n_comp, iv, b, input[k]);
-            }
-            /* add in texel */
+         for (k = N_TEXELS / 2 - 1; k >= 0; k--) {
             lohi <<= 2;
-            lohi |= texel;
+            if (ISTBLACK(input[N_TEXELS / 2 + k]))
+               lohi |= n_vect + 1; /* transparent black */
+            else
+               lohi |= texel[k];
          }
          cc[1] = lohi;
       }
@@ -1114,6 +1168,7 @@ fxt1_quantize_MIXED0 (GLuint *cc,
    const GLint n_comp = 3; /* 3 components: R, G, B */
    GLubyte vec[2 * 2][MAX_COMP]; /* 2 extrema for each sub-block */
    GLfloat b, iv[MAX_COMP]; /* interpolation vector */
+   GLint texel[N_TEXELS / 2]; /* lerp index of each microtile texel */
    GLint i, j, k;
    Fx64 hi; /* high quadword */
    GLuint lohi, lolo; /* low quadword: hi dword, lo dword */
@@ -1208,14 +1263,11 @@ fxt1_quantize_MIXED0 (GLuint *cc,
       MAKEIVEC(n_vect, n_comp, iv, b, vec[0], vec[1]);
 
       /* add in texels */
+      fxt1_lerp_indices(texel, input, n_vect, n_comp, iv, b);
       lolo = 0;
       for (k = N_TEXELS / 2 - 1; k >= 0; k--) {
-         GLint texel;
-         /* interpolate color */
-         CALCCDOT(texel, n_vect, n_comp, iv, b, input[k]);
-         /* add in texel */
          lolo <<= 2;
-         lolo |= texel;
+         lolo |= texel[k];
       }
 
       /* funky encoding for LSB of green */
@@ -1241,14 +1293,11 @@ fxt1_quantize_MIXED0 (GLuint *cc,
       MAKEIVEC(n_vect, n_comp, iv, b, vec[2], vec[3]);
 
       /* add in texels */
+      fxt1_lerp_indices(texel, &input[N_TEXELS / 2], n_vect, n_comp, iv, b);
       lohi = 0;
-      for (k = N_TEXELS - 1; k >= N_TEXELS / 2; k--) {
-         GLint texel;
-         /* interpolate color */
-         CALCCDOT(texel, n_vect, n_comp, iv, b, input[k]);
-         /* add in texel */
+      for (k = N_TEXELS / 2 - 1; k >= 0; k--) {
          lohi <<= 2;
-         lohi |= texel;
+         lohi |= texel[k];
       }
 
       /* funky encoding for LSB of green */
@@ -1364,15 +1413,68 @@ fxt1_quantize (GLuint *cc, const GLubyte *lines[], GLint comps)
 }
 
 
+/**
+ * Encode the rows of 8x4 blocks covering texel rows [y0, y1).
+ * \param destRowStride  bytes between rows of blocks
+ */
+static void
+fxt1_encode_rows (GLuint y0, GLuint y1, GLuint width, GLint comps,
+                  const GLubyte *data, GLint srcRowStride,
+                  GLubyte *dest, GLint destRowStride)
+{
+   GLuint x, y;
+
+   for (y = y0; y < y1; y += 4) {
+      GLuint *encoded = (GLuint *)(dest + (y / 4) * destRowStride);
+      GLuint offs = 0 + (y + 0) * srcRowStride;
+      for (x = 0; x < width; x += 8) {
+         const GLubyte *lines[4];
+         lines[0] = &data[offs];
+         lines[1] = lines[0] + srcRowStride;
+         lines[2] = lines[1] + srcRowStride;
+         lines[3] = lines[2] + srcRowStride;
+         offs += 8 * comps;
+         fxt1_quantize(encoded, lines, comps);
+         /* 128 bits per 8x4 block */
+         encoded += 4;
+      }
+   }
+}
+
+
+#define FXT1_MIN_BLOCKS_PER_THREAD 1024
+
+struct fxt1_encode_job {
+   GLuint width;
+   GLint comps;
+   const GLubyte *data;
+   GLint srcRowStride;
+   GLubyte *dest;
+   GLint destRowStride;
+};
+
+
+/**
+ * Encode the rows of blocks [row0, row1), see _mesa_run_row_threads().
+ */
+static void
+fxt1_encode_block_rows (void *data, GLuint thread, GLint row0, GLint row1)
+{
+   const struct fxt1_encode_job *job = (const struct fxt1_encode_job *) data;
+   (void) thread;
+   fxt1_encode_rows(row0 * 4, row1 * 4, job->width, job->comps,
+                    job->data, job->srcRowStride,
+                    job->dest, job->destRowStride);
+}
+
+
 static void
 fxt1_encode (GLuint width, GLuint height, GLint comps,
              const void *source, GLint srcRowStride,
              void *dest, GLint destRowStride)
 {
-   GLuint x, y;
-   const GLubyte *data;
-   GLuint *encoded = (GLuint *)dest;
    void *newSource = NULL;
+   struct fxt1_encode_job job;
 
    assert(comps == 3 || comps == 4);
 
@@ -1416,23 +1518,19 @@ fxt1_encode (GLuint width, GLuint height, GLint comps,
       source = dest;  /* the new, GLubyte incoming image */
    }
 
-   data = (const GLubyte *) source;
-   destRowStride = (destRowStride - width * 2) / 4;
-   for (y = 0; y < height; y += 4) {
-      GLuint offs = 0 + (y + 0) * srcRowStride;
-      for (x = 0; x < width; x += 8) {
-         const GLubyte *lines[4];
-         lines[0] = &data[offs];
-         lines[1] = lines[0] + srcRowStride;
-         lines[2] = lines[1] + srcRowStride;
-         lines[3] = lines[2] + srcRowStride;
-         offs += 8 * comps;
-         fxt1_quantize(encoded, lines, comps);
-         /* 128 bits per 8x4 block */
-         encoded += 4;
-      }
-      encoded += destRowStride;
-   }
+   /* every block is encoded independently, so split the block rows
+    * over several threads if there are enough of them
+    */
+   job.width = width;
+   job.comps = comps;
+   job.data = (const GLubyte *) source;
+   job.srcRowStride = srcRowStride;
+   job.dest = (GLubyte *) dest;
+   job.destRowStride = destRowStride;
+   _mesa_run_row_threads(_mesa_num_row_threads(height / 4,
+                                               (width / 8) * (height / 4),
+                                               FXT1_MIN_BLOCKS_PER_THREAD),
+                         0, height / 4, fxt1_encode_block_rows, &job);
 
  cleanUp:
    if (newSource != NULL) {
@@ -1695,21 +1793,22 @@ fxt1_decode_1ALPHA (const GLubyte *code, GLint t, GLchan *rgba)
 }
 
 
+static void (*decode_1[]) (const GLubyte *, GLint, GLchan *) = {
+   fxt1_decode_1HI,     /* cc-high   = "00?" */
+   fxt1_decode_1HI,     /* cc-high   = "00?" */
+   fxt1_decode_1CHROMA, /* cc-chroma = "010" */
+   fxt1_decode_1ALPHA,  /* alpha     = "011" */
+   fxt1_decode_1MIXED,  /* mixed     = "1??" */
+   fxt1_decode_1MIXED,  /* mixed     = "1??" */
+   fxt1_decode_1MIXED,  /* mixed     = "1??" */
+   fxt1_decode_1MIXED   /* mixed     = "1??" */
+};
+
+
 void
 fxt1_decode_1 (const void *texture, GLint stride, /* in pixels */
                GLint i, GLint j, GLchan *rgba)
 {
-   static void (*decode_1[]) (const GLubyte *, GLint, GLchan *) = {
-      fxt1_decode_1HI,     /* cc-high   = "00?" */
-      fxt1_decode_1HI,     /* cc-high   = "00?" */
-      fxt1_decode_1CHROMA, /* cc-chroma = "010" */
-      fxt1_decode_1ALPHA,  /* alpha     = "011" */
-      fxt1_decode_1MIXED,  /* mixed     = "1??" */
-      fxt1_decode_1MIXED,  /* mixed     = "1??" */
-      fxt1_decode_1MIXED,  /* mixed     = "1??" */
-      fxt1_decode_1MIXED   /* mixed     = "1??" */
-   };
-
    const GLubyte *code = (const GLubyte *)texture +
                          ((j / 4) * (stride / 8) + (i / 8)) * 16;
    GLint mode = CC_SEL(code, 125);
@@ -1722,3 +1821,26 @@ fxt1_decode_1 (const void *texture, GLint stride, /* in pixels */
 
    decode_1[mode](code, t, rgba);
 }
+
+
+/**
+ * Decode the whole 8x4 block containing texel (i, j).
+ * The 32 texels are returned row by row.
+ */
+void
+fxt1_decode_block (const void *texture, GLint stride, /* in pixels */
+                   GLint i, GLint j, GLchan rgba[][4])
+{
+   const GLubyte *code = (const GLubyte *)texture +
+                         ((j / 4) * (stride / 8) + (i / 8)) * 16;
+   void (*decode)(const GLubyte *, GLint, GLchan *) =
+      decode_1[CC_SEL(code, 125)];
+   GLint x, y;
+
+   for (y = 0; y < 4; y++) {
+      for (x = 0; x < 8; x++) {
+         GLint t = (x & 4) ? x + 12 : x;
+         decode(code, t + y * 4, rgba[y * 8 + x]);
+      }
+   }
+}
@@ -1157,6 +1157,7 @@ create_new_program(GLcontext *ctx, struct state_key *key,
 /**
  * Return a fragment program which implements the current
  * fixed-function texture, fog and color-sum operations.
+ * The caller gets a reference to the program, which it must release.
  */
 struct gl_fragment_program *
 _mesa_get_fixed_func_fragment_program(GLcontext *ctx)
@@ -1167,16 +1168,18 @@ _mesa_get_fixed_func_fragment_program(GLcontext *ctx)
    make_state_key(ctx, &key);
       
    prog = (struct gl_fragment_program *)
-      _mesa_search_program_cache(ctx->FragmentProgram.Cache,
+      _mesa_search_program_cache(ctx->Shared->FragmentProgramCache,
                                  &key, sizeof(key));
 
    if (!prog) {
       prog = (struct gl_fragment_program *) 
          ctx->Driver.NewProgram(ctx, GL_FRAGMENT_PROGRAM_ARB, 0);
+      if (!prog)
+         return NULL;
 
       create_new_program(ctx, &key, prog);
 
-      _mesa_program_cache_insert(ctx, ctx->FragmentProgram.Cache,
+      _mesa_program_cache_insert(ctx, ctx->Shared->FragmentProgramCache,
                                  &key, sizeof(key), &prog->Base);
    }
 
@@ -1208,6 +1211,7 @@ _mesa_UpdateTexEnvProgram( GLcontext *ctx )
 
       _mesa_reference_fragprog(ctx, &ctx->FragmentProgram._Current, newProg);
       _mesa_reference_fragprog(ctx, &ctx->FragmentProgram._TexEnvProgram, newProg);
+      _mesa_reference_fragprog(ctx, &newProg, NULL);
    } 
 
    /* Tell the driver about the change.  Could define a new target for
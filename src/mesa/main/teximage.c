@@ -49,6 +49,10 @@
 #include "mtypes.h"
 
 
+/** Protects the texture image stamp counter */
+_glthread_DECLARE_STATIC_MUTEX(StampMutex);
+
+
 /**
  * We allocate texture memory on 512-byte boundaries so we can use MMX/SSE
  * elsewhere.
@@ -1177,6 +1181,23 @@ clear_teximage_fields(struct gl_texture_image *img)
    img->FetchTexelf = NULL;
    img->IsCompressed = 0;
    img->CompressedSize = 0;
+   _mesa_touch_texture_image(img);
+}
+
+
+/**
+ * Give the image a new Stamp after its texels were specified, modified
+ * or freed.  Stamps come from a global counter, so they also tell apart
+ * different images which happened to be allocated at the same address.
+ * Used by caches of texel data, see the swrast texel block cache.
+ */
+void
+_mesa_touch_texture_image(struct gl_texture_image *texImage)
+{
+   static GLuint stamp = 0;
+   _glthread_LOCK_MUTEX(StampMutex);
+   texImage->Stamp = ++stamp;
+   _glthread_UNLOCK_MUTEX(StampMutex);
 }
 
 
@@ -1208,6 +1229,8 @@ _mesa_init_teximage_fields(GLcontext *ctx, GLenum target,
    ASSERT(height >= 0);
    ASSERT(depth >= 0);
 
+   _mesa_touch_texture_image(img);
+
    img->_BaseFormat = _mesa_base_tex_format( ctx, internalFormat );
    ASSERT(img->_BaseFormat > 0);
    img->InternalFormat = internalFormat;
@@ -1829,7 +1852,7 @@ subtexture_error_check2( GLcontext *ctx, GLuint dimensions,
    }
 #endif
 
-   if (destTex->IsCompressed) {
+   if (destTex->IsCompressed && !_mesa_is_upload_compressed(destTex)) {
       if (!target_can_be_compressed(ctx, target)) {
          _mesa_error(ctx, GL_INVALID_ENUM,
                      "glTexSubImage%D(target)", dimensions);
@@ -2189,7 +2212,7 @@ copytexsubimage_error_check2( GLcontext *ctx, GLuint dimensions,
       }
    }
 
-   if (teximage->IsCompressed) {
+   if (teximage->IsCompressed && !_mesa_is_upload_compressed(teximage)) {
       if (!target_can_be_compressed(ctx, target)) {
          _mesa_error(ctx, GL_INVALID_ENUM,
                      "glCopyTexSubImage%d(target)", dimensions);
@@ -2777,6 +2800,7 @@ _mesa_TexSubImage1D( GLenum target, GLint level,
       (*ctx->Driver.TexSubImage1D)(ctx, target, level, xoffset, width,
 				   format, type, pixels, &ctx->Unpack,
 				   texObj, texImage);
+      _mesa_touch_texture_image(texImage);
       ctx->NewState |= _NEW_TEXTURE;
    }
  out:
@@ -2837,6 +2861,7 @@ _mesa_TexSubImage2D( GLenum target, GLint level,
       (*ctx->Driver.TexSubImage2D)(ctx, target, level, xoffset, yoffset,
 				   width, height, format, type, pixels,
 				   &ctx->Unpack, texObj, texImage);
+      _mesa_touch_texture_image(texImage);
       ctx->NewState |= _NEW_TEXTURE;
    }
  out:
@@ -2892,6 +2917,7 @@ _mesa_TexSubImage3D( GLenum target, GLint level,
 				   width, height, depth,
 				   format, type, pixels,
 				   &ctx->Unpack, texObj, texImage );
+      _mesa_touch_texture_image(texImage);
       ctx->NewState |= _NEW_TEXTURE;
    }
  out:
@@ -3079,6 +3105,7 @@ _mesa_CopyTexSubImage1D( GLenum target, GLint level,
          ASSERT(ctx->Driver.CopyTexSubImage1D);
          ctx->Driver.CopyTexSubImage1D(ctx, target, level,
                                        xoffset, x, y, width);
+         _mesa_touch_texture_image(texImage);
       }
 
       ctx->NewState |= _NEW_TEXTURE;
@@ -3133,6 +3160,7 @@ _mesa_CopyTexSubImage2D( GLenum target, GLint level,
          ASSERT(ctx->Driver.CopyTexSubImage2D);
          ctx->Driver.CopyTexSubImage2D(ctx, target, level,
 				       xoffset, yoffset, x, y, width, height);
+         _mesa_touch_texture_image(texImage);
       }
 
       ctx->NewState |= _NEW_TEXTURE;
@@ -3190,6 +3218,7 @@ _mesa_CopyTexSubImage3D( GLenum target, GLint level,
          ctx->Driver.CopyTexSubImage3D(ctx, target, level,
 				       xoffset, yoffset, zoffset,
 				       x, y, width, height);
+         _mesa_touch_texture_image(texImage);
       }
 
       ctx->NewState |= _NEW_TEXTURE;
@@ -3726,6 +3755,7 @@ _mesa_CompressedTexSubImage1DARB(GLenum target, GLint level, GLint xoffset,
 						xoffset, width,
 						format, imageSize, data,
 						texObj, texImage);
+	 _mesa_touch_texture_image(texImage);
       }
       ctx->NewState |= _NEW_TEXTURE;
    }
@@ -3784,6 +3814,7 @@ _mesa_CompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset,
 						xoffset, yoffset, width, height,
 						format, imageSize, data,
 						texObj, texImage);
+	 _mesa_touch_texture_image(texImage);
       }
       ctx->NewState |= _NEW_TEXTURE;
    }
@@ -3843,6 +3874,7 @@ _mesa_CompressedTexSubImage3DARB(GLenum target, GLint level, GLint xoffset,
 						width, height, depth,
 						format, imageSize, data,
 						texObj, texImage);
+	 _mesa_touch_texture_image(texImage);
       }
       ctx->NewState |= _NEW_TEXTURE;
    }
@@ -65,6 +65,9 @@ _mesa_free_texture_image_data( GLcontext *ctx,
 			       struct gl_texture_image *texImage );
 
 
+extern void
+_mesa_touch_texture_image(struct gl_texture_image *texImage);
+
 extern void
 _mesa_init_teximage_fields(GLcontext *ctx, GLenum target,
                            struct gl_texture_image *img,
@@ -2965,7 +2965,10 @@ choose_texture_format(GLcontext *ctx, struct gl_texture_image *texImage,
    ASSERT(ctx->Driver.ChooseTextureFormat);
 
    texImage->TexFormat
-      = ctx->Driver.ChooseTextureFormat(ctx, internalFormat, format, type);
+      = _mesa_choose_upload_compression(ctx, texImage, dims, internalFormat);
+   if (!texImage->TexFormat)
+      texImage->TexFormat
+         = ctx->Driver.ChooseTextureFormat(ctx, internalFormat, format, type);
 
    ASSERT(texImage->TexFormat);
 
@@ -3262,6 +3265,101 @@ _mesa_store_texsubimage1d(GLcontext *ctx, GLenum target, GLint level,
 
 
 
+/**
+ * Store a sub-image into a texture image which was compressed by the
+ * "compress on upload" option and whose bounds aren't aligned to the
+ * compressed tiles.  The affected tiles are decompressed, the new texels
+ * are merged in, and the tiles are compressed again.
+ */
+static GLboolean
+store_unaligned_compressed_subimage(GLcontext *ctx,
+                                    struct gl_texture_image *texImage,
+                                    GLint xoffset, GLint yoffset,
+                                    GLint width, GLint height,
+                                    GLenum format, GLenum type,
+                                    const GLvoid *pixels,
+                                    const struct gl_pixelstore_attrib *packing)
+{
+   const GLuint mesaFormat = texImage->TexFormat->MesaFormat;
+   const GLbitfield transferOps
+      = ctx->_ImageTransferState & ~IMAGE_CONVOLUTION_BIT;
+   GLuint bw, bh;
+   GLint x0, y0, x1, y1, tileWidth, tileHeight, i, j;
+   GLint dstRowStride;
+   GLbitfield saveTransferState;
+   GLboolean success;
+   GLchan *tiles;
+
+   _mesa_compressed_block_size(mesaFormat, &bw, &bh);
+   x0 = xoffset / bw * bw;
+   y0 = yoffset / bh * bh;
+   x1 = MIN2((GLint) ((xoffset + width + bw - 1) / bw * bw),
+             (GLint) texImage->Width);
+   y1 = MIN2((GLint) ((yoffset + height + bh - 1) / bh * bh),
+             (GLint) texImage->Height);
+   tileWidth = x1 - x0;
+   tileHeight = y1 - y0;
+
+   tiles = (GLchan *) _mesa_malloc(tileWidth * tileHeight * 4 * sizeof(GLchan));
+   if (!tiles)
+      return GL_FALSE;
+
+   /* decompress the tiles touched by the sub-image */
+   for (j = 0; j < tileHeight; j++) {
+      for (i = 0; i < tileWidth; i++) {
+         texImage->FetchTexelc(texImage, x0 + i, y0 + j, 0,
+                               tiles + (j * tileWidth + i) * 4);
+      }
+   }
+
+   /* merge in the new texels */
+   for (j = 0; j < height; j++) {
+      const GLvoid *src = _mesa_image_address2d(packing, pixels, width, height,
+                                                format, type, j, 0);
+      GLchan *dst = tiles + ((yoffset - y0 + j) * tileWidth
+                             + (xoffset - x0)) * 4;
+      _mesa_unpack_color_span_chan(ctx, width, GL_RGBA, dst,
+                                   format, type, src, packing, transferOps);
+   }
+
+   /* compress the tiles again; the pixel transfer ops were applied above
+    * and must not be applied to the old texels.
+    */
+   dstRowStride = _mesa_compressed_row_stride(mesaFormat, texImage->Width);
+   saveTransferState = ctx->_ImageTransferState;
+   ctx->_ImageTransferState = 0;
+   success = texImage->TexFormat->StoreImage(ctx, 2, texImage->_BaseFormat,
+                                             texImage->TexFormat,
+                                             texImage->Data,
+                                             x0, y0, 0,
+                                             dstRowStride,
+                                             texImage->ImageOffsets,
+                                             tileWidth, tileHeight, 1,
+                                             GL_RGBA, CHAN_TYPE, tiles,
+                                             &ctx->DefaultPacking);
+   ctx->_ImageTransferState = saveTransferState;
+
+   _mesa_free(tiles);
+   return success;
+}
+
+
+/**
+ * Does the sub-image rectangle cut through the tiles of a compressed image?
+ */
+static GLboolean
+is_unaligned_subimage(const struct gl_texture_image *texImage,
+                      GLint xoffset, GLint yoffset,
+                      GLint width, GLint height)
+{
+   GLuint bw, bh;
+   _mesa_compressed_block_size(texImage->TexFormat->MesaFormat, &bw, &bh);
+   return (xoffset % bw) || (yoffset % bh) ||
+          ((width % bw) && xoffset + width != (GLint) texImage->Width) ||
+          ((height % bh) && yoffset + height != (GLint) texImage->Height);
+}
+
+
 /**
  * This is the software fallback for Driver.TexSubImage2D()
  * and Driver.CopyTexSubImage2D().
@@ -3281,7 +3379,16 @@ _mesa_store_texsubimage2d(GLcontext *ctx, GLenum target, GLint level,
    if (!pixels)
       return;
 
-   {
+   if (_mesa_is_upload_compressed(texImage) &&
+       is_unaligned_subimage(texImage, xoffset, yoffset, width, height)) {
+      if (!store_unaligned_compressed_subimage(ctx, texImage,
+                                               xoffset, yoffset,
+                                               width, height, format, type,
+                                               pixels, packing)) {
+         _mesa_error(ctx, GL_OUT_OF_MEMORY, "glTexSubImage2D");
+      }
+   }
+   else {
       GLint dstRowStride = 0;
       GLboolean success;
       if (texImage->IsCompressed) {
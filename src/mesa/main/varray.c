@@ -623,6 +623,28 @@ _mesa_VertexAttribPointerARB(GLuint index, GLint size, GLenum type,
    if (ctx->Driver.VertexAttribPointer)
       ctx->Driver.VertexAttribPointer(ctx, index, size, type, stride, ptr);
 }
+
+
+/**
+ * Set the instance divisor of a generic vertex array.
+ * With a non-zero divisor, the array advances once per \p divisor
+ * instances of glDraw*InstancedARB rather than once per vertex.
+ */
+void GLAPIENTRY
+_mesa_VertexAttribDivisorARB(GLuint index, GLuint divisor)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   ASSERT_OUTSIDE_BEGIN_END_AND_FLUSH(ctx);
+
+   if (index >= ctx->Const.VertexProgram.MaxAttribs) {
+      _mesa_error(ctx, GL_INVALID_VALUE, "glVertexAttribDivisorARB(index)");
+      return;
+   }
+
+   ctx->Array.ArrayObj->VertexAttrib[index].Divisor = divisor;
+   ctx->NewState |= _NEW_ARRAY;
+   ctx->Array.NewState |= _NEW_ARRAY_ATTRIB(index);
+}
 #endif
 
 
@@ -126,6 +126,10 @@ _mesa_VertexAttribPointerARB(GLuint index, GLint size, GLenum type,
                              const GLvoid *pointer);
 
 
+extern void GLAPIENTRY
+_mesa_VertexAttribDivisorARB(GLuint index, GLuint divisor);
+
+
 extern void GLAPIENTRY
 _mesa_InterleavedArrays(GLenum format, GLsizei stride, const GLvoid *pointer);
 
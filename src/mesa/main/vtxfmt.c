@@ -130,6 +130,10 @@ install_vtxfmt( struct _glapi_table *tab, const GLvertexformat *vfmt )
    SET_DrawArrays(tab, vfmt->DrawArrays);
    SET_DrawElements(tab, vfmt->DrawElements);
    SET_DrawRangeElements(tab, vfmt->DrawRangeElements);
+   SET_MultiDrawArraysEXT(tab, vfmt->MultiDrawArraysEXT);
+   SET_MultiDrawElementsEXT(tab, vfmt->MultiDrawElementsEXT);
+   SET_DrawArraysInstancedARB(tab, vfmt->DrawArraysInstancedARB);
+   SET_DrawElementsInstancedARB(tab, vfmt->DrawElementsInstancedARB);
    SET_EvalMesh1(tab, vfmt->EvalMesh1);
    SET_EvalMesh2(tab, vfmt->EvalMesh2);
    ASSERT(tab->EvalMesh2);
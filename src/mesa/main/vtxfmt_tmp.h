@@ -343,6 +343,36 @@ static void GLAPIENTRY TAG(DrawRangeElements)( GLenum mode, GLuint start,
    CALL_DrawRangeElements(GET_DISPATCH(), ( mode, start, end, count, type, indices ));
 }
 
+static void GLAPIENTRY TAG(MultiDrawArraysEXT)( GLenum mode, GLint *first,
+				     GLsizei *count, GLsizei primcount )
+{
+   PRE_LOOPBACK( MultiDrawArraysEXT );
+   CALL_MultiDrawArraysEXT(GET_DISPATCH(), ( mode, first, count, primcount ));
+}
+
+static void GLAPIENTRY TAG(MultiDrawElementsEXT)( GLenum mode, const GLsizei *count,
+				       GLenum type, const GLvoid **indices,
+				       GLsizei primcount )
+{
+   PRE_LOOPBACK( MultiDrawElementsEXT );
+   CALL_MultiDrawElementsEXT(GET_DISPATCH(), ( mode, count, type, indices, primcount ));
+}
+
+static void GLAPIENTRY TAG(DrawArraysInstancedARB)( GLenum mode, GLint first,
+					 GLsizei count, GLsizei primcount )
+{
+   PRE_LOOPBACK( DrawArraysInstancedARB );
+   CALL_DrawArraysInstancedARB(GET_DISPATCH(), ( mode, first, count, primcount ));
+}
+
+static void GLAPIENTRY TAG(DrawElementsInstancedARB)( GLenum mode, GLsizei count,
+					   GLenum type, const GLvoid *indices,
+					   GLsizei primcount )
+{
+   PRE_LOOPBACK( DrawElementsInstancedARB );
+   CALL_DrawElementsInstancedARB(GET_DISPATCH(), ( mode, count, type, indices, primcount ));
+}
+
 static void GLAPIENTRY TAG(EvalMesh1)( GLenum mode, GLint i1, GLint i2 )
 {
    PRE_LOOPBACK( EvalMesh1 );
@@ -522,6 +552,10 @@ static GLvertexformat TAG(vtxfmt) = {
    TAG(DrawArrays),
    TAG(DrawElements),
    TAG(DrawRangeElements),
+   TAG(MultiDrawArraysEXT),
+   TAG(MultiDrawElementsEXT),
+   TAG(DrawArraysInstancedARB),
+   TAG(DrawElementsInstancedARB),
    TAG(EvalMesh1),
    TAG(EvalMesh2)
 };
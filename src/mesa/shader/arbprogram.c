@@ -325,6 +325,13 @@ _mesa_GetVertexAttribfvARB(GLuint index, GLenum pname, GLfloat *params)
       case GL_VERTEX_ATTRIB_ARRAY_NORMALIZED_ARB:
          params[0] = ctx->Array.ArrayObj->VertexAttrib[index].Normalized;
          break;
+      case GL_VERTEX_ATTRIB_ARRAY_DIVISOR_ARB:
+         if (!ctx->Extensions.ARB_instanced_arrays) {
+            _mesa_error(ctx, GL_INVALID_ENUM, "glGetVertexAttribfvARB(pname)");
+            return;
+         }
+         params[0] = (GLfloat) ctx->Array.ArrayObj->VertexAttrib[index].Divisor;
+         break;
       case GL_CURRENT_VERTEX_ATTRIB_ARB:
          if (index == 0) {
             _mesa_error(ctx, GL_INVALID_OPERATION,
@@ -29,22 +29,35 @@
 #include "main/glheader.h"
 #include "main/mtypes.h"
 #include "main/imports.h"
+#include "glapi/glthread.h"
 #include "shader/prog_cache.h"
 #include "shader/program.h"
 
 
+/**
+ * Once a cache holds this many programs, inserting another one evicts
+ * the least recently used.
+ */
+#define CACHE_MAX_ITEMS 2048
+
+
 struct cache_item
 {
    GLuint hash;
    void *key;
    struct gl_program *program;
    struct cache_item *next;
+   /** Doubly-linked list in order of use, most recent first */
+   struct cache_item *lru_prev, *lru_next;
 };
 
 struct gl_program_cache
 {
+   _glthread_Mutex Mutex;   /**< caches live in gl_shared_state */
    struct cache_item **items;
    GLuint size, n_items;
+   struct cache_item *lru_head, *lru_tail;
+   struct gl_program_cache_stats stats;
 };
 
 
@@ -85,6 +98,8 @@ rehash(struct gl_program_cache *cache)
 
    size = cache->size * 3;
    items = (struct cache_item**) _mesa_malloc(size * sizeof(*items));
+   if (!items)
+      return;  /* keep the old table, chains just get longer */
    _mesa_memset(items, 0, size * sizeof(*items));
 
    for (i = 0; i < cache->size; i++)
@@ -100,6 +115,62 @@ rehash(struct gl_program_cache *cache)
 }
 
 
+static void
+lru_unlink(struct gl_program_cache *cache, struct cache_item *c)
+{
+   if (c->lru_prev)
+      c->lru_prev->lru_next = c->lru_next;
+   else
+      cache->lru_head = c->lru_next;
+   if (c->lru_next)
+      c->lru_next->lru_prev = c->lru_prev;
+   else
+      cache->lru_tail = c->lru_prev;
+}
+
+
+static void
+lru_push_front(struct gl_program_cache *cache, struct cache_item *c)
+{
+   c->lru_prev = NULL;
+   c->lru_next = cache->lru_head;
+   if (cache->lru_head)
+      cache->lru_head->lru_prev = c;
+   else
+      cache->lru_tail = c;
+   cache->lru_head = c;
+}
+
+
+/**
+ * Drop the least recently used program from the cache.
+ * Contexts still using it keep their own references.
+ */
+static void
+evict_lru(GLcontext *ctx, struct gl_program_cache *cache)
+{
+   struct cache_item *victim = cache->lru_tail;
+   struct cache_item **prev;
+
+   if (!victim)
+      return;
+
+   for (prev = &cache->items[victim->hash % cache->size];
+        *prev != victim;
+        prev = &(*prev)->next)
+      ;
+   *prev = victim->next;
+   lru_unlink(cache, victim);
+
+   _mesa_free(victim->key);
+   _mesa_reference_program(ctx, &victim->program, NULL);
+   _mesa_free(victim);
+
+   cache->n_items--;
+   cache->stats.Evictions++;
+}
+
+
 static void
 clear_cache(GLcontext *ctx, struct gl_program_cache *cache)
 {
@@ -116,7 +187,7 @@ clear_cache(GLcontext *ctx, struct gl_program_cache *cache)
       cache->items[i] = NULL;
    }
 
-
+   cache->lru_head = cache->lru_tail = NULL;
    cache->n_items = 0;
 }
 
@@ -134,6 +205,7 @@ _mesa_new_program_cache(void)
          _mesa_free(cache);
          return NULL;
       }
+      _glthread_INIT_MUTEX(cache->Mutex);
    }
    return cache;
 }
@@ -143,27 +215,58 @@ void
 _mesa_delete_program_cache(GLcontext *ctx, struct gl_program_cache *cache)
 {
    clear_cache(ctx, cache);
+   _glthread_DESTROY_MUTEX(cache->Mutex);
    _mesa_free(cache->items);
    _mesa_free(cache);
 }
 
 
+/**
+ * Look up the program generated for the given state key.
+ * A reference is taken while the cache is locked, so another context
+ * can't evict and delete the program before the caller gets it; the
+ * caller must release it.  A hit makes the program the most recently
+ * used one, so that takes CACHE_MAX_ITEMS further insertions.
+ */
 struct gl_program *
-_mesa_search_program_cache(const struct gl_program_cache *cache,
+_mesa_search_program_cache(struct gl_program_cache *cache,
                            const void *key, GLuint keysize)
 {
    const GLuint hash = hash_key(key, keysize);
+   struct gl_program *program = NULL;
    struct cache_item *c;
 
+   _glthread_LOCK_MUTEX(cache->Mutex);
+
    for (c = cache->items[hash % cache->size]; c; c = c->next) {
-      if (c->hash == hash && memcmp(c->key, key, keysize) == 0)
-	 return c->program;
+      if (c->hash == hash && memcmp(c->key, key, keysize) == 0) {
+         if (c != cache->lru_head) {
+            lru_unlink(cache, c);
+            lru_push_front(cache, c);
+         }
+         /* no ctx needed: 'program' is NULL so nothing can be deleted */
+         _mesa_reference_program(NULL, &program, c->program);
+         break;
+      }
    }
 
-   return NULL;
+   if (program)
+      cache->stats.Hits++;
+   else
+      cache->stats.Misses++;
+
+   _glthread_UNLOCK_MUTEX(cache->Mutex);
+
+   return program;
 }
 
 
+/**
+ * Add a program to the cache, which takes its own reference.
+ * If another context inserted a program for the same key since our
+ * search, both entries stay: lookups find the newer one and the older
+ * one ages out.
+ */
 void
 _mesa_program_cache_insert(GLcontext *ctx,
                            struct gl_program_cache *cache,
@@ -173,21 +276,46 @@ _mesa_program_cache_insert(GLcontext *ctx,
    const GLuint hash = hash_key(key, keysize);
    struct cache_item *c = CALLOC_STRUCT(cache_item);
 
+   if (!c)
+      return;
+
    c->hash = hash;
 
    c->key = _mesa_malloc(keysize);
+   if (!c->key) {
+      _mesa_free(c);
+      return;
+   }
    memcpy(c->key, key, keysize);
 
-   c->program = program;  /* no refcount change */
+   _mesa_reference_program(ctx, &c->program, program);
 
-   if (cache->n_items > cache->size * 1.5) {
-      if (cache->size < 1000)
-	 rehash(cache);
-      else 
-	 clear_cache(ctx, cache);
-   }
+   _glthread_LOCK_MUTEX(cache->Mutex);
+
+   while (cache->n_items >= CACHE_MAX_ITEMS)
+      evict_lru(ctx, cache);
+
+   if (cache->n_items > cache->size * 1.5)
+      rehash(cache);
 
    cache->n_items++;
    c->next = cache->items[hash % cache->size];
    cache->items[hash % cache->size] = c;
+   lru_push_front(cache, c);
+
+   _glthread_UNLOCK_MUTEX(cache->Mutex);
+}
+
+
+/**
+ * Return the cache's hit/miss/eviction counters and current size.
+ */
+void
+_mesa_program_cache_stats(struct gl_program_cache *cache,
+                          struct gl_program_cache_stats *stats)
+{
+   _glthread_LOCK_MUTEX(cache->Mutex);
+   *stats = cache->stats;
+   stats->Items = cache->n_items;
+   _glthread_UNLOCK_MUTEX(cache->Mutex);
 }
@@ -34,6 +34,16 @@
 struct gl_program_cache;
 
 
+/** Counters returned by _mesa_program_cache_stats() */
+struct gl_program_cache_stats
+{
+   GLuint Hits;
+   GLuint Misses;
+   GLuint Evictions;
+   GLuint Items;      /**< programs currently in the cache */
+};
+
+
 extern struct gl_program_cache *
 _mesa_new_program_cache(void);
 
@@ -42,7 +52,7 @@ _mesa_delete_program_cache(GLcontext *ctx, struct gl_program_cache *pc);
 
 
 extern struct gl_program *
-_mesa_search_program_cache(const struct gl_program_cache *cache,
+_mesa_search_program_cache(struct gl_program_cache *cache,
                            const void *key, GLuint keysize);
 
 extern void
@@ -51,5 +61,9 @@ _mesa_program_cache_insert(GLcontext *ctx,
                            const void *key, GLuint keysize,
                            struct gl_program *program);
 
+extern void
+_mesa_program_cache_stats(struct gl_program_cache *cache,
+                          struct gl_program_cache_stats *stats);
+
 
 #endif /* PROG_CACHE_H */
@@ -229,23 +229,8 @@ fetch_vector4_deriv(GLcontext * ctx,
                     char xOrY, GLfloat result[4])
 {
    if (source->File == PROGRAM_INPUT && source->Index < (GLint)machine->NumDeriv) {
-      const GLint col = machine->CurElement;
-      const GLfloat w = machine->Attribs[FRAG_ATTRIB_WPOS][col][3];
-      const GLfloat invQ = 1.0f / w;
-      GLfloat deriv[4];
-
-      if (xOrY == 'X') {
-         deriv[0] = machine->DerivX[source->Index][0] * invQ;
-         deriv[1] = machine->DerivX[source->Index][1] * invQ;
-         deriv[2] = machine->DerivX[source->Index][2] * invQ;
-         deriv[3] = machine->DerivX[source->Index][3] * invQ;
-      }
-      else {
-         deriv[0] = machine->DerivY[source->Index][0] * invQ;
-         deriv[1] = machine->DerivY[source->Index][1] * invQ;
-         deriv[2] = machine->DerivY[source->Index][2] * invQ;
-         deriv[3] = machine->DerivY[source->Index][3] * invQ;
-      }
+      const GLfloat *deriv = (xOrY == 'X')
+         ? machine->DerivX[source->Index] : machine->DerivY[source->Index];
 
       result[0] = deriv[GET_SWZ(source->Swizzle, 0)];
       result[1] = deriv[GET_SWZ(source->Swizzle, 1)];
@@ -320,10 +305,31 @@ fetch_texel(GLcontext *ctx,
        inst->SrcReg[0].Index == FRAG_ATTRIB_TEX0 + inst->TexSrcUnit) {
       /* simple texture fetch for which we should have derivatives */
       GLuint attr = inst->SrcReg[0].Index;
-      machine->FetchTexelDeriv(ctx, texcoord,
-                               machine->DerivX[attr],
-                               machine->DerivY[attr],
-                               lodBias, unit, color);
+      const GLfloat q = texcoord[3];
+      if ((inst->Opcode == OPCODE_TXP ||
+           (inst->Opcode == OPCODE_TXP_NV &&
+            inst->TexSrcTarget != TEXTURE_CUBE_INDEX)) && q != 0.0F) {
+         /* texcoord was divided by q; d(s/q) = (ds - s/q * dq) / q */
+         const GLfloat *dx = machine->DerivX[attr];
+         const GLfloat *dy = machine->DerivY[attr];
+         const GLfloat invQ = 1.0F / q;
+         GLfloat texdx[4], texdy[4];
+         GLuint i;
+         for (i = 0; i < 3; i++) {
+            texdx[i] = (dx[i] - texcoord[i] * dx[3]) * invQ;
+            texdy[i] = (dy[i] - texcoord[i] * dy[3]) * invQ;
+         }
+         texdx[3] = dx[3];
+         texdy[3] = dy[3];
+         machine->FetchTexelDeriv(ctx, texcoord, texdx, texdy,
+                                  lodBias, unit, color);
+      }
+      else {
+         machine->FetchTexelDeriv(ctx, texcoord,
+                                  machine->DerivX[attr],
+                                  machine->DerivY[attr],
+                                  lodBias, unit, color);
+      }
    }
    else {
       machine->FetchTexelLod(ctx, texcoord, lodBias, unit, color);
@@ -58,10 +58,78 @@ _mesa_free_parameter_list(struct gl_program_parameter_list *paramList)
    _mesa_free(paramList->Parameters);
    if (paramList->ParameterValues)
       _mesa_align_free(paramList->ParameterValues);
+   if (paramList->NameHash)
+      _mesa_free(paramList->NameHash);
    _mesa_free(paramList);
 }
 
 
+/**
+ * Does the (possibly not null-terminated) name match the parameter's name?
+ */
+static INLINE GLboolean
+parameter_name_matches(const char *pname, GLsizei nameLen, const char *name)
+{
+   if (!pname)
+      return GL_FALSE;
+   if (nameLen < 0)
+      return _mesa_strcmp(pname, name) == 0;
+   return _mesa_strncmp(pname, name, nameLen) == 0 && pname[nameLen] == 0;
+}
+
+
+/**
+ * Enter parameter 'index' in the name hash, unless it's unnamed or an
+ * earlier parameter has the same name (lookups return the first one).
+ */
+static void
+hash_parameter(struct gl_program_parameter_list *paramList, GLuint index)
+{
+   const char *name = paramList->Parameters[index].Name;
+   const GLuint mask = paramList->NameHashSize - 1;
+   GLuint h;
+
+   if (!name)
+      return;
+
+   h = _mesa_hash_program_name(name, -1) & mask;
+   while (paramList->NameHash[h]) {
+      const GLuint j = paramList->NameHash[h] - 1;
+      if (_mesa_strcmp(paramList->Parameters[j].Name, name) == 0)
+         return;
+      h = (h + 1) & mask;
+   }
+   paramList->NameHash[h] = index + 1;
+}
+
+
+/**
+ * (Re)build the name hash so that it is at most half full.
+ * If out of memory the hash is dropped and lookups fall back to a
+ * linear search.
+ */
+static void
+rehash_parameters(struct gl_program_parameter_list *paramList)
+{
+   GLuint size = 16, i;
+
+   while (size < 2 * paramList->NumParameters)
+      size *= 2;
+
+   if (paramList->NameHash)
+      _mesa_free(paramList->NameHash);
+   paramList->NameHash = (GLuint *) _mesa_calloc(size * sizeof(GLuint));
+   if (!paramList->NameHash) {
+      paramList->NameHashSize = 0;
+      return;
+   }
+   paramList->NameHashSize = size;
+
+   for (i = 0; i < paramList->NumParameters; i++)
+      hash_parameter(paramList, i);
+}
+
+
 /**
  * Add a new parameter to a parameter list.
  * Note that parameter values are usually 4-element GLfloat vectors.
@@ -109,12 +177,18 @@ _mesa_add_parameter(struct gl_program_parameter_list *paramList,
       /* out of memory */
       paramList->NumParameters = 0;
       paramList->Size = 0;
+      if (paramList->NameHash) {
+         _mesa_free(paramList->NameHash);
+         paramList->NameHash = NULL;
+         paramList->NameHashSize = 0;
+      }
       return -1;
    }
    else {
       GLuint i;
 
       paramList->NumParameters = oldNum + sz4;
+      paramList->StateContext = NULL;
 
       _mesa_memset(&paramList->Parameters[oldNum], 0, 
 		   sz4 * sizeof(struct gl_program_parameter));
@@ -141,6 +215,11 @@ _mesa_add_parameter(struct gl_program_parameter_list *paramList,
             paramList->Parameters[oldNum].StateIndexes[i] = state[i];
       }
 
+      if (2 * paramList->NumParameters > paramList->NameHashSize)
+         rehash_parameters(paramList);
+      else
+         hash_parameter(paramList, oldNum);
+
       return (GLint) oldNum;
    }
 }
@@ -284,8 +363,10 @@ void
 _mesa_use_uniform(struct gl_program_parameter_list *paramList,
                   const char *name)
 {
-   GLuint i;
-   for (i = 0; i < paramList->NumParameters; i++) {
+   GLint i = _mesa_lookup_parameter_index(paramList, -1, name);
+   if (i < 0)
+      return;
+   for (; i < (GLint) paramList->NumParameters; i++) {
       struct gl_program_parameter *p = paramList->Parameters + i;
       if (p->Type == PROGRAM_UNIFORM && _mesa_strcmp(p->Name, name) == 0) {
          p->Used = GL_TRUE;
@@ -469,6 +550,30 @@ _mesa_lookup_parameter_value(const struct gl_program_parameter_list *paramList,
 }
 
 
+/**
+ * Compute the hash value of a parameter or uniform name.
+ * \param name  the name
+ * \param nameLen  length of name (in chars).
+ *                 If length is negative, assume that name is null-terminated.
+ */
+GLuint
+_mesa_hash_program_name(const char *name, GLsizei nameLen)
+{
+   const char *end = nameLen < 0 ? NULL : name + nameLen;
+   GLuint hash = 0;
+
+   while (end ? name < end : *name != 0) {
+      GLuint g;
+      hash = (hash << 4) + (GLubyte) *name++;
+      g = hash & 0xf0000000;
+      if (g)
+         hash ^= g >> 24;
+      hash &= ~g;
+   }
+   return hash;
+}
+
+
 /**
  * Given a program parameter name, find its position in the list of parameters.
  * \param paramList  the parameter list to search
@@ -486,22 +591,22 @@ _mesa_lookup_parameter_index(const struct gl_program_parameter_list *paramList,
    if (!paramList)
       return -1;
 
-   if (nameLen == -1) {
-      /* name is null-terminated */
-      for (i = 0; i < (GLint) paramList->NumParameters; i++) {
-         if (paramList->Parameters[i].Name &&
-	     _mesa_strcmp(paramList->Parameters[i].Name, name) == 0)
+   if (paramList->NameHash) {
+      const GLuint mask = paramList->NameHashSize - 1;
+      GLuint h = _mesa_hash_program_name(name, nameLen) & mask;
+      while (paramList->NameHash[h]) {
+         i = paramList->NameHash[h] - 1;
+         if (parameter_name_matches(paramList->Parameters[i].Name,
+                                    nameLen, name))
             return i;
+         h = (h + 1) & mask;
       }
+      return -1;
    }
-   else {
-      /* name is not null-terminated, use nameLen */
-      for (i = 0; i < (GLint) paramList->NumParameters; i++) {
-         if (paramList->Parameters[i].Name &&
-	     _mesa_strncmp(paramList->Parameters[i].Name, name, nameLen) == 0
-             && _mesa_strlen(paramList->Parameters[i].Name) == (size_t)nameLen)
-            return i;
-      }
+
+   for (i = 0; i < (GLint) paramList->NumParameters; i++) {
+      if (parameter_name_matches(paramList->Parameters[i].Name, nameLen, name))
+         return i;
    }
    return -1;
 }
@@ -49,6 +49,8 @@ struct gl_program_parameter
    GLenum DataType;         /**< GL_FLOAT, GL_FLOAT_VEC2, etc */
    GLuint Size;             /**< Number of components (1..4) */
    GLboolean Used;          /**< Helper flag for GLSL uniform tracking */
+   GLbitfield StateFlags;   /**< _NEW_* flags for a PROGRAM_STATE_VAR, or 0
+                                 if it must be fetched on every load */
    /**
     * A sequence of STATE_* tokens and integers to identify GL state.
     */
@@ -67,6 +69,12 @@ struct gl_program_parameter_list
    GLfloat (*ParameterValues)[4];        /**< Array [Size] of GLfloat[4] */
    GLbitfield StateFlags; /**< _NEW_* flags indicating which state changes
                                might invalidate ParameterValues[] */
+   GLuint *NameHash;      /**< open-addressed table of (index + 1) of the
+                               first parameter with each name, or NULL */
+   GLuint NameHashSize;   /**< size of NameHash, a power of two */
+   const GLcontext *StateContext; /**< context the state vars were last
+                                       loaded from, NULL if never/invalid */
+   GLuint StateSerial;    /**< StateContext->_StateSerial at that load */
 };
 
 
@@ -141,6 +149,9 @@ extern GLint
 _mesa_lookup_parameter_index(const struct gl_program_parameter_list *paramList,
                              GLsizei nameLen, const char *name);
 
+extern GLuint
+_mesa_hash_program_name(const char *name, GLsizei nameLen);
+
 extern GLboolean
 _mesa_lookup_parameter_constant(const struct gl_program_parameter_list *list,
                                 const GLfloat v[], GLuint vSize,
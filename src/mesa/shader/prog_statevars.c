@@ -501,6 +501,11 @@ _mesa_fetch_state(GLcontext *ctx, const gl_state_index state[],
          }
          return;
 
+      case STATE_INSTANCE_ID:
+         value[0] = (GLfloat) ctx->Array.InstanceID;
+         value[1] = value[2] = value[3] = 0.0F;
+         return;
+
       default:
          /* unknown state indexes are silently ignored
           *  should be handled by the driver.
@@ -579,6 +584,8 @@ _mesa_program_state_flags(const gl_state_index state[STATE_LENGTH])
 	 return _NEW_TEXTURE;
       case STATE_FOG_PARAMS_OPTIMIZED:
 	 return _NEW_FOG;
+      case STATE_INSTANCE_ID:
+	 return _NEW_ARRAY;
       default:
          /* unknown state indexes are silently ignored and
          *  no flag set, since it is handled by the driver.
@@ -757,6 +764,9 @@ append_token(char *dst, gl_state_index k)
    case STATE_SHADOW_AMBIENT:
       append(dst, "ShadowAmbient");
       break;
+   case STATE_INSTANCE_ID:
+      append(dst, "InstanceID");
+      break;
    default:
       ;
    }
@@ -888,16 +898,37 @@ _mesa_program_state_string(const gl_state_index state[STATE_LENGTH])
 }
 
 
+/**
+ * Return the _NEW_* flags guarding the cached value of a state variable
+ * in _mesa_load_state_parameters(), or 0 if it has to be fetched on every
+ * load.  The instance ID changes between draws without any state flag
+ * being raised, and driver-internal indexes have no flags at all.
+ */
+static GLbitfield
+load_state_flags(const gl_state_index state[STATE_LENGTH])
+{
+   if (state[0] == STATE_INTERNAL && state[1] == STATE_INSTANCE_ID)
+      return 0;
+   return _mesa_program_state_flags(state);
+}
+
+
 /**
  * Loop over all the parameters in a parameter list.  If the parameter
  * is a GL state reference, look up the current value of that state
  * variable and put it into the parameter's Value[4] array.
  * This would be called at glBegin time when using a fragment program.
+ *
+ * Values are only re-fetched when the state groups they depend on have
+ * changed since the list was last loaded (per ctx->_StateBitSerial[]),
+ * so derived values such as inverse matrices are recomputed once per
+ * change rather than once per draw.
  */
 void
 _mesa_load_state_parameters(GLcontext *ctx,
                             struct gl_program_parameter_list *paramList)
 {
+   struct gl_program_parameter *params;
    GLuint i;
 
    if (!paramList)
@@ -905,13 +936,48 @@ _mesa_load_state_parameters(GLcontext *ctx,
 
    /*assert(ctx->Driver.NeedFlush == 0);*/
 
-   for (i = 0; i < paramList->NumParameters; i++) {
-      if (paramList->Parameters[i].Type == PROGRAM_STATE_VAR) {
-         _mesa_fetch_state(ctx,
-			   (gl_state_index *) paramList->Parameters[i].StateIndexes,
-                           paramList->ParameterValues[i]);
+   params = paramList->Parameters;
+
+   if (paramList->StateContext != ctx ||
+       (GLint) (ctx->_StateSerial - paramList->StateSerial) < 0) {
+      /* Never loaded, parameters added since, or last loaded from
+       * another context: fetch everything.
+       */
+      for (i = 0; i < paramList->NumParameters; i++) {
+         if (params[i].Type == PROGRAM_STATE_VAR) {
+            params[i].StateFlags = load_state_flags(params[i].StateIndexes);
+            _mesa_fetch_state(ctx, params[i].StateIndexes,
+                              paramList->ParameterValues[i]);
+         }
+      }
+   }
+   else {
+      /* State not yet validated counts as changed, as does the material
+       * while GL_COLOR_MATERIAL tracks the current color (that doesn't
+       * raise _NEW_LIGHT).
+       */
+      GLbitfield dirty = ctx->NewState;
+      GLbitfield bit;
+
+      if (ctx->Light.ColorMaterialEnabled)
+         dirty |= _NEW_LIGHT;
+
+      for (i = 0, bit = 1; bit; i++, bit <<= 1) {
+         if ((GLint) (ctx->_StateBitSerial[i] - paramList->StateSerial) > 0)
+            dirty |= bit;
+      }
+
+      for (i = 0; i < paramList->NumParameters; i++) {
+         if (params[i].Type == PROGRAM_STATE_VAR &&
+             (params[i].StateFlags == 0 || (params[i].StateFlags & dirty))) {
+            _mesa_fetch_state(ctx, params[i].StateIndexes,
+                              paramList->ParameterValues[i]);
+         }
       }
    }
+
+   paramList->StateContext = ctx;
+   paramList->StateSerial = ctx->_StateSerial;
 }
 
 
@@ -30,6 +30,7 @@
 
 #include "main/imports.h"
 #include "main/mtypes.h"
+#include "prog_parameter.h"
 #include "prog_uniform.h"
 
 
@@ -48,10 +49,54 @@ _mesa_free_uniform_list(struct gl_uniform_list *list)
       _mesa_free((void *) list->Uniforms[i].Name);
    }
    _mesa_free(list->Uniforms);
+   if (list->NameHash)
+      _mesa_free(list->NameHash);
    _mesa_free(list);
 }
 
 
+/**
+ * Enter uniform 'index' in the list's name hash.
+ */
+static void
+hash_uniform(struct gl_uniform_list *list, GLuint index)
+{
+   const GLuint mask = list->NameHashSize - 1;
+   GLuint h = _mesa_hash_program_name(list->Uniforms[index].Name, -1) & mask;
+
+   while (list->NameHash[h])
+      h = (h + 1) & mask;
+   list->NameHash[h] = index + 1;
+}
+
+
+/**
+ * (Re)build the name hash so that it is at most half full.
+ * If out of memory the hash is dropped and lookups fall back to a
+ * linear search.
+ */
+static void
+rehash_uniforms(struct gl_uniform_list *list)
+{
+   GLuint size = 16, i;
+
+   while (size < 2 * list->NumUniforms)
+      size *= 2;
+
+   if (list->NameHash)
+      _mesa_free(list->NameHash);
+   list->NameHash = (GLuint *) _mesa_calloc(size * sizeof(GLuint));
+   if (!list->NameHash) {
+      list->NameHashSize = 0;
+      return;
+   }
+   list->NameHashSize = size;
+
+   for (i = 0; i < list->NumUniforms; i++)
+      hash_uniform(list, i);
+}
+
+
 GLboolean
 _mesa_append_uniform(struct gl_uniform_list *list,
                      const char *name, GLenum target, GLuint progPos)
@@ -81,6 +126,11 @@ _mesa_append_uniform(struct gl_uniform_list *list,
          /* out of memory */
          list->NumUniforms = 0;
          list->Size = 0;
+         if (list->NameHash) {
+            _mesa_free(list->NameHash);
+            list->NameHash = NULL;
+            list->NameHashSize = 0;
+         }
          return GL_FALSE;
       }
 
@@ -89,6 +139,11 @@ _mesa_append_uniform(struct gl_uniform_list *list,
       list->Uniforms[oldNum].FragPos = -1;
       index = oldNum;
       list->NumUniforms++;
+
+      if (2 * list->NumUniforms > list->NameHashSize)
+         rehash_uniforms(list);
+      else
+         hash_uniform(list, index);
    }
 
    /* update position for the vertex or fragment program */
@@ -119,6 +174,20 @@ GLint
 _mesa_lookup_uniform(const struct gl_uniform_list *list, const char *name)
 {
    GLuint i;
+
+   if (list && list->NameHash) {
+      const GLuint mask = list->NameHashSize - 1;
+      GLuint h = _mesa_hash_program_name(name, -1) & mask;
+      while (list->NameHash[h]) {
+         i = list->NameHash[h] - 1;
+         if (!_mesa_strcmp(list->Uniforms[i].Name, name)) {
+            return i;
+         }
+         h = (h + 1) & mask;
+      }
+      return -1;
+   }
+
    for (i = 0; list && i < list->NumUniforms; i++) {
       if (!_mesa_strcmp(list->Uniforms[i].Name, name)) {
          return i;
@@ -65,6 +65,9 @@ struct gl_uniform_list
    GLuint Size;                 /**< allocated size of Uniforms array */
    GLuint NumUniforms;          /**< number of uniforms in the array */
    struct gl_uniform *Uniforms; /**< Array [Size] */
+   GLuint *NameHash;            /**< open-addressed table of (index + 1),
+                                     by name, or NULL */
+   GLuint NameHashSize;         /**< size of NameHash, a power of two */
 };
 
 
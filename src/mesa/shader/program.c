@@ -33,7 +33,6 @@
 #include "main/context.h"
 #include "main/hash.h"
 #include "program.h"
-#include "prog_cache.h"
 #include "prog_parameter.h"
 #include "prog_instruction.h"
 
@@ -71,7 +70,6 @@ _mesa_init_program(GLcontext *ctx)
       ctx->VertexProgram.TrackMatrix[i] = GL_NONE;
       ctx->VertexProgram.TrackMatrixTransform[i] = GL_IDENTITY_NV;
    }
-   ctx->VertexProgram.Cache = _mesa_new_program_cache();
 #endif
 
 #if FEATURE_NV_fragment_program || FEATURE_ARB_fragment_program
@@ -79,7 +77,6 @@ _mesa_init_program(GLcontext *ctx)
    _mesa_reference_fragprog(ctx, &ctx->FragmentProgram.Current,
                             ctx->Shared->DefaultFragmentProgram);
    assert(ctx->FragmentProgram.Current);
-   ctx->FragmentProgram.Cache = _mesa_new_program_cache();
 #endif
 
 
@@ -101,12 +98,15 @@ _mesa_free_program_data(GLcontext *ctx)
 {
 #if FEATURE_NV_vertex_program || FEATURE_ARB_vertex_program
    _mesa_reference_vertprog(ctx, &ctx->VertexProgram.Current, NULL);
-   _mesa_delete_program_cache(ctx, ctx->VertexProgram.Cache);
 #endif
 #if FEATURE_NV_fragment_program || FEATURE_ARB_fragment_program
    _mesa_reference_fragprog(ctx, &ctx->FragmentProgram.Current, NULL);
-   _mesa_delete_program_cache(ctx, ctx->FragmentProgram.Cache);
 #endif
+   /* programs from the shared fixed-function caches */
+   _mesa_reference_vertprog(ctx, &ctx->VertexProgram._Current, NULL);
+   _mesa_reference_vertprog(ctx, &ctx->VertexProgram._TnlProgram, NULL);
+   _mesa_reference_fragprog(ctx, &ctx->FragmentProgram._Current, NULL);
+   _mesa_reference_fragprog(ctx, &ctx->FragmentProgram._TexEnvProgram, NULL);
    /* XXX probably move this stuff */
 #if FEATURE_ATI_fragment_shader
    if (ctx->ATIFragmentShader.Current) {
@@ -226,6 +226,7 @@ _mesa_init_program_struct( GLcontext *ctx, struct gl_program *prog,
    if (prog) {
       GLuint i;
       _mesa_bzero(prog, sizeof(*prog));
+      _glthread_INIT_MUTEX(prog->Mutex);
       prog->Id = id;
       prog->Target = target;
       prog->Resident = GL_TRUE;
@@ -325,6 +326,8 @@ _mesa_delete_program(GLcontext *ctx, struct gl_program *prog)
 
    _mesa_free_instructions(prog->Instructions, prog->NumInstructions);
 
+   _glthread_DESTROY_MUTEX(prog->Mutex);
+
    if (prog->Parameters) {
       _mesa_free_parameter_list(prog->Parameters);
    }
@@ -384,7 +387,7 @@ _mesa_reference_program(GLcontext *ctx,
    if (*ptr) {
       GLboolean deleteFlag;
 
-      /*_glthread_LOCK_MUTEX((*ptr)->Mutex);*/
+      _glthread_LOCK_MUTEX((*ptr)->Mutex);
 #if 0
       printf("Program %p ID=%u Target=%s  Refcount-- to %d\n",
              *ptr, (*ptr)->Id,
@@ -395,7 +398,7 @@ _mesa_reference_program(GLcontext *ctx,
       (*ptr)->RefCount--;
 
       deleteFlag = ((*ptr)->RefCount == 0);
-      /*_glthread_UNLOCK_MUTEX((*ptr)->Mutex);*/
+      _glthread_UNLOCK_MUTEX((*ptr)->Mutex);
 
       if (deleteFlag) {
          ASSERT(ctx);
@@ -407,7 +410,7 @@ _mesa_reference_program(GLcontext *ctx,
 
    assert(!*ptr);
    if (prog) {
-      /*_glthread_LOCK_MUTEX(prog->Mutex);*/
+      _glthread_LOCK_MUTEX(prog->Mutex);
       prog->RefCount++;
 #if 0
       printf("Program %p ID=%u Target=%s  Refcount++ to %d\n",
@@ -415,7 +418,7 @@ _mesa_reference_program(GLcontext *ctx,
              (prog->Target == GL_VERTEX_PROGRAM_ARB ? "VP" : "FP"),
              prog->RefCount);
 #endif
-      /*_glthread_UNLOCK_MUTEX(prog->Mutex);*/
+      _glthread_UNLOCK_MUTEX(prog->Mutex);
    }
 
    *ptr = prog;
@@ -129,6 +129,11 @@ lookup_statevar(const char *var, GLint index1, GLint index2, const char *field,
          return -1;
       }
    }
+   else if (strcmp(var, "gl_InstanceIDARB") == 0) {
+      tokens[0] = STATE_INTERNAL;
+      tokens[1] = STATE_INSTANCE_ID;
+      *swizzleOut = SWIZZLE_XXXX;
+   }
    else if (strcmp(var, "gl_ClipPlane") == 0) {
       tokens[0] = STATE_CLIPPLANE;
       tokens[1] = index1;
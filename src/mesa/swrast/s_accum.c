@@ -28,6 +28,7 @@
 #include "main/macros.h"
 #include "main/imports.h"
 #include "main/fbobject.h"
+#include "main/rowthreads.h"
 
 #include "s_accum.h"
 #include "s_context.h"
@@ -73,6 +74,286 @@
 #endif
 
 
+/**
+ * Parameters of an accumulation operation, for accum_rows().  Everything
+ * is done row by row, so the rows of a large buffer can be shared out
+ * among several threads.
+ */
+struct accum_job {
+   GLcontext *ctx;
+   GLenum op;              /**< GL_ADD, GL_MULT, etc. or GL_NONE */
+   GLfloat value;          /**< for GL_RETURN, the final color scale */
+   GLboolean rescale;      /**< rescale each row by rescaleScale first? */
+   GLfloat rescaleScale;
+   GLboolean masking;      /**< color masking for GL_RETURN */
+   GLint xpos, width;
+};
+
+
+/*
+ * The per-row functions below loop over all the components of a row in
+ * one go (RCOMP..ACOMP are 0..3) so that the compiler can vectorize them.
+ */
+
+static void
+scale_row(GLshort acc[], GLuint n, GLfloat scale)
+{
+   GLuint i;
+   for (i = 0; i < n; i++) {
+      acc[i] = (GLshort) (acc[i] * scale);
+   }
+}
+
+
+static void
+add_row(GLshort acc[], GLuint n, GLshort incr)
+{
+   GLuint i;
+   for (i = 0; i < n; i++) {
+      acc[i] += incr;
+   }
+}
+
+
+static void
+accum_row(GLshort acc[], const GLchan rgba[], GLuint n,
+          GLboolean integer, GLfloat scale)
+{
+   GLuint i;
+   if (integer) {
+      /* simply add integer color values into accum buffer */
+      for (i = 0; i < n; i++) {
+         acc[i] += rgba[i];
+      }
+   }
+   else {
+      /* scaled integer (or float) accum buffer */
+      for (i = 0; i < n; i++) {
+         acc[i] += (GLshort) ((GLfloat) rgba[i] * scale);
+      }
+   }
+}
+
+
+static void
+load_row(GLshort acc[], const GLchan rgba[], GLuint n,
+         GLboolean integer, GLfloat scale)
+{
+   GLuint i;
+   if (integer) {
+      /* just copy values in */
+      for (i = 0; i < n; i++) {
+         acc[i] = rgba[i];
+      }
+   }
+   else {
+      /* scaled integer (or float) accum buffer */
+      for (i = 0; i < n; i++) {
+         acc[i] = (GLshort) ((GLfloat) rgba[i] * scale);
+      }
+   }
+}
+
+
+static void
+return_row(GLchan rgba[], const GLshort acc[], GLuint n, GLfloat scale)
+{
+   GLuint i;
+   for (i = 0; i < n; i++) {
+#if CHAN_BITS==32
+      GLchan c = acc[i] * scale;
+#else
+      GLint c = IROUND( (GLfloat) acc[i] * scale );
+#endif
+      rgba[i] = CLAMP( c, 0, CHAN_MAX );
+   }
+}
+
+
+/**
+ * Do an accumulation operation on rows [y0, y1).
+ * See _mesa_run_row_threads().
+ */
+static void
+accum_rows(void *data, GLuint thread, GLint y0, GLint y1)
+{
+   const struct accum_job *job = (const struct accum_job *) data;
+   GLcontext *ctx = job->ctx;
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct gl_framebuffer *fb = ctx->DrawBuffer;
+   struct gl_renderbuffer *accumRb = fb->Attachment[BUFFER_ACCUM].Renderbuffer;
+   const GLboolean directAccess
+      = (accumRb->GetPointer(ctx, accumRb, 0, 0) != NULL);
+   const GLboolean integer = swrast->_IntegerAccumMode;
+   const GLint xpos = job->xpos, width = job->width;
+   const GLuint n = 4 * width;
+   GLshort accumRow[4 * MAX_WIDTH];
+   GLchan rgba[4 * MAX_WIDTH];
+   GLint y;
+
+   (void) thread;
+
+   for (y = y0; y < y1; y++) {
+      GLshort *acc;
+
+      if (directAccess) {
+         acc = (GLshort *) accumRb->GetPointer(ctx, accumRb, xpos, y);
+      }
+      else {
+         accumRb->GetRow(ctx, accumRb, width, xpos, y, accumRow);
+         acc = accumRow;
+      }
+
+      if (job->rescale) {
+         scale_row(acc, n, job->rescaleScale);
+      }
+
+      switch (job->op) {
+      case GL_ADD:
+         add_row(acc, n, (GLshort) (job->value * ACCUM_SCALE16));
+         break;
+      case GL_MULT:
+         scale_row(acc, n, job->value);
+         break;
+      case GL_ACCUM:
+      case GL_LOAD:
+         /* read colors from color buffer */
+         _swrast_read_rgba_span(ctx, ctx->ReadBuffer->_ColorReadBuffer, width,
+                                xpos, y, CHAN_TYPE, rgba);
+         if (job->op == GL_ACCUM)
+            accum_row(acc, rgba, n, integer,
+                      job->value * ACCUM_SCALE16 / CHAN_MAXF);
+         else
+            load_row(acc, rgba, n, integer,
+                     job->value * ACCUM_SCALE16 / CHAN_MAXF);
+         break;
+      case GL_RETURN:
+         {
+            GLuint buffer;
+
+            return_row(rgba, acc, n, job->value);
+
+            /* store colors */
+            for (buffer = 0; buffer < fb->_NumColorDrawBuffers; buffer++) {
+               struct gl_renderbuffer *rb = fb->_ColorDrawBuffers[buffer];
+               if (job->masking) {
+                  SWspan span;
+                  INIT_SPAN(span, GL_BITMAP);
+                  span.end = width;
+                  span.arrayMask = SPAN_RGBA;
+                  span.x = xpos;
+                  span.y = y;
+                  _mesa_memcpy(span.array->rgba, rgba,
+                               4 * width * sizeof(GLchan));
+                  _swrast_mask_rgba_span(ctx, rb, &span);
+                  rb->PutRow(ctx, rb, width, xpos, y, span.array->rgba, NULL);
+               }
+               else {
+                  rb->PutRow(ctx, rb, width, xpos, y, rgba, NULL);
+               }
+            }
+         }
+         break;
+      default:
+         /* just rescaling */
+         break;
+      }
+
+      if (!directAccess && (job->op != GL_RETURN || job->rescale)) {
+         accumRb->PutRow(ctx, accumRb, width, xpos, y, accumRow, NULL);
+      }
+   }
+}
+
+
+#define ACCUM_MIN_PIXELS_PER_THREAD (64 * 1024)
+
+
+/**
+ * How many threads to use for the given job.  Only renderbuffers which
+ * are directly addressable are known to be plain memory that may be
+ * accessed by several threads at once, so anything else is done by the
+ * calling thread alone.
+ */
+static GLuint
+accum_num_threads(const struct accum_job *job, GLint height)
+{
+   GLcontext *ctx = job->ctx;
+   struct gl_framebuffer *fb = ctx->DrawBuffer;
+   struct gl_renderbuffer *rb = fb->Attachment[BUFFER_ACCUM].Renderbuffer;
+   GLuint i;
+
+   if (!rb->GetPointer(ctx, rb, 0, 0))
+      return 1;
+
+   if (job->op == GL_ACCUM || job->op == GL_LOAD) {
+      rb = ctx->ReadBuffer->_ColorReadBuffer;
+      if (!rb->GetPointer(ctx, rb, 0, 0))
+         return 1;
+   }
+   else if (job->op == GL_RETURN) {
+      /* masking uses the context's span arrays */
+      if (job->masking)
+         return 1;
+      for (i = 0; i < fb->_NumColorDrawBuffers; i++) {
+         rb = fb->_ColorDrawBuffers[i];
+         if (!rb->GetPointer(ctx, rb, 0, 0))
+            return 1;
+      }
+   }
+
+   return _mesa_num_row_threads(height, (GLfloat) job->width * height,
+                                ACCUM_MIN_PIXELS_PER_THREAD);
+}
+
+
+/**
+ * Do an accumulation operation on the rows [ypos, ypos + height), with
+ * several threads if the buffers and the region are big enough.
+ */
+static void
+run_accum_job(struct accum_job *job, GLint ypos, GLint height)
+{
+   GLcontext *ctx = job->ctx;
+   struct gl_renderbuffer *rb
+      = ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer;
+
+   if (rb->DataType != GL_SHORT && rb->DataType != GL_UNSIGNED_SHORT) {
+      /* other types someday */
+      return;
+   }
+
+   _mesa_run_row_threads(accum_num_threads(job, height),
+                         ypos, ypos + height, accum_rows, job);
+}
+
+
+static void
+init_accum_job(struct accum_job *job, GLcontext *ctx, GLenum op,
+               GLfloat value, GLint xpos, GLint width)
+{
+   job->ctx = ctx;
+   job->op = op;
+   job->value = value;
+   job->rescale = GL_FALSE;
+   job->rescaleScale = 1.0F;
+   job->masking = GL_FALSE;
+   job->xpos = xpos;
+   job->width = width;
+}
+
+
+/**
+ * Factor by which the unscaled values of the optimized accum buffer mode
+ * must be multiplied to give scaled values representing [-1, 1].
+ */
+static GLfloat
+accum_rescale_factor(GLcontext *ctx)
+{
+   return SWRAST_CONTEXT(ctx)->_IntegerAccumScaler * (32767.0F / CHAN_MAXF);
+}
+
+
 /**
  * This is called when we fall out of optimized/unscaled accum buffer mode.
  * That is, we convert each unscaled accum buffer value into a scaled value
@@ -84,7 +365,7 @@ rescale_accum( GLcontext *ctx )
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
    struct gl_renderbuffer *rb
       = ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer;
-   const GLfloat s = swrast->_IntegerAccumScaler * (32767.0F / CHAN_MAXF);
+   struct accum_job job;
 
    assert(rb);
    assert(rb->_BaseFormat == GL_RGBA);
@@ -92,32 +373,38 @@ rescale_accum( GLcontext *ctx )
    assert(rb->DataType == GL_SHORT || rb->DataType == GL_UNSIGNED_SHORT);
    assert(swrast->_IntegerAccumMode);
 
-   if (rb->GetPointer(ctx, rb, 0, 0)) {
-      /* directly-addressable memory */
-      GLuint y;
-      for (y = 0; y < rb->Height; y++) {
-         GLuint i;
-         GLshort *acc = (GLshort *) rb->GetPointer(ctx, rb, 0, y);
-         for (i = 0; i < 4 * rb->Width; i++) {
-            acc[i] = (GLshort) (acc[i] * s);
-         }
-      }
+   init_accum_job(&job, ctx, GL_NONE, 0.0F, 0, rb->Width);
+   job.rescale = GL_TRUE;
+   job.rescaleScale = accum_rescale_factor(ctx);
+   run_accum_job(&job, 0, rb->Height);
+
+   swrast->_IntegerAccumMode = GL_FALSE;
+}
+
+
+/**
+ * Leave optimized accum buffer mode ahead of an operation on the given
+ * region.  When the region is the whole buffer the rescaling is folded
+ * into the operation's own pass over the buffer instead of taking a
+ * separate one.
+ */
+static void
+leave_integer_accum_mode(struct accum_job *job, GLint ypos, GLint height)
+{
+   GLcontext *ctx = job->ctx;
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct gl_renderbuffer *rb
+      = ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer;
+
+   if (job->xpos == 0 && ypos == 0 &&
+       job->width == (GLint) rb->Width && height == (GLint) rb->Height) {
+      job->rescale = GL_TRUE;
+      job->rescaleScale = accum_rescale_factor(ctx);
+      swrast->_IntegerAccumMode = GL_FALSE;
    }
    else {
-      /* use get/put row funcs */
-      GLuint y;
-      for (y = 0; y < rb->Height; y++) {
-         GLshort accRow[MAX_WIDTH * 4];
-         GLuint i;
-         rb->GetRow(ctx, rb, rb->Width, 0, y, accRow);
-         for (i = 0; i < 4 * rb->Width; i++) {
-            accRow[i] = (GLshort) (accRow[i] * s);
-         }
-         rb->PutRow(ctx, rb, rb->Width, 0, y, accRow, NULL);
-      }
+      rescale_accum(ctx);
    }
-
-   swrast->_IntegerAccumMode = GL_FALSE;
 }
 
 
@@ -188,41 +475,17 @@ accum_add(GLcontext *ctx, GLfloat value,
           GLint xpos, GLint ypos, GLint width, GLint height )
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
-   struct gl_renderbuffer *rb
-      = ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer;
+   struct accum_job job;
 
-   assert(rb);
+   assert(ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer);
+
+   init_accum_job(&job, ctx, GL_ADD, value, xpos, width);
 
    /* Leave optimized accum buffer mode */
    if (swrast->_IntegerAccumMode)
-      rescale_accum(ctx);
+      leave_integer_accum_mode(&job, ypos, height);
 
-   if (rb->DataType == GL_SHORT || rb->DataType == GL_UNSIGNED_SHORT) {
-      const GLshort incr = (GLshort) (value * ACCUM_SCALE16);
-      if (rb->GetPointer(ctx, rb, 0, 0)) {
-         GLint i, j;
-         for (i = 0; i < height; i++) {
-            GLshort *acc = (GLshort *) rb->GetPointer(ctx, rb, xpos, ypos + i);
-            for (j = 0; j < 4 * width; j++) {
-               acc[j] += incr;
-            }
-         }
-      }
-      else {
-         GLint i, j;
-         for (i = 0; i < height; i++) {
-            GLshort accRow[4 * MAX_WIDTH];
-            rb->GetRow(ctx, rb, width, xpos, ypos + i, accRow);
-            for (j = 0; j < 4 * width; j++) {
-               accRow[j] += incr;
-            }
-            rb->PutRow(ctx, rb, width, xpos, ypos + i, accRow, NULL);
-         }
-      }
-   }
-   else {
-      /* other types someday */
-   }
+   run_accum_job(&job, ypos, height);
 }
 
 
@@ -231,40 +494,17 @@ accum_mult(GLcontext *ctx, GLfloat mult,
            GLint xpos, GLint ypos, GLint width, GLint height )
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
-   struct gl_renderbuffer *rb
-      = ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer;
+   struct accum_job job;
 
-   assert(rb);
+   assert(ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer);
+
+   init_accum_job(&job, ctx, GL_MULT, mult, xpos, width);
 
    /* Leave optimized accum buffer mode */
    if (swrast->_IntegerAccumMode)
-      rescale_accum(ctx);
+      leave_integer_accum_mode(&job, ypos, height);
 
-   if (rb->DataType == GL_SHORT || rb->DataType == GL_UNSIGNED_SHORT) {
-      if (rb->GetPointer(ctx, rb, 0, 0)) {
-         GLint i, j;
-         for (i = 0; i < height; i++) {
-            GLshort *acc = (GLshort *) rb->GetPointer(ctx, rb, xpos, ypos + i);
-            for (j = 0; j < 4 * width; j++) {
-               acc[j] = (GLshort) (acc[j] * mult);
-            }
-         }
-      }
-      else {
-         GLint i, j;
-         for (i = 0; i < height; i++) {
-            GLshort accRow[4 * MAX_WIDTH];
-            rb->GetRow(ctx, rb, width, xpos, ypos + i, accRow);
-            for (j = 0; j < 4 * width; j++) {
-               accRow[j] = (GLshort) (accRow[j] * mult);
-            }
-            rb->PutRow(ctx, rb, width, xpos, ypos + i, accRow, NULL);
-         }
-      }
-   }
-   else {
-      /* other types someday */
-   }
+   run_accum_job(&job, ypos, height);
 }
 
 
@@ -274,73 +514,24 @@ accum_accum(GLcontext *ctx, GLfloat value,
             GLint xpos, GLint ypos, GLint width, GLint height )
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
-   struct gl_renderbuffer *rb
-      = ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer;
-   const GLboolean directAccess = (rb->GetPointer(ctx, rb, 0, 0) != NULL);
+   struct accum_job job;
 
-   assert(rb);
+   assert(ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer);
 
    if (!ctx->ReadBuffer->_ColorReadBuffer) {
       /* no read buffer - OK */
       return;
    }
 
+   init_accum_job(&job, ctx, GL_ACCUM, value, xpos, width);
+
    /* May have to leave optimized accum buffer mode */
    if (swrast->_IntegerAccumScaler == 0.0 && value > 0.0 && value <= 1.0)
       swrast->_IntegerAccumScaler = value;
    if (swrast->_IntegerAccumMode && value != swrast->_IntegerAccumScaler)
-      rescale_accum(ctx);
+      leave_integer_accum_mode(&job, ypos, height);
 
-   if (rb->DataType == GL_SHORT || rb->DataType == GL_UNSIGNED_SHORT) {
-      const GLfloat scale = value * ACCUM_SCALE16 / CHAN_MAXF;
-      GLshort accumRow[4 * MAX_WIDTH];
-      GLchan rgba[MAX_WIDTH][4];
-      GLint i;
-
-      for (i = 0; i < height; i++) {
-         GLshort *acc;
-         if (directAccess) {
-            acc = (GLshort *) rb->GetPointer(ctx, rb, xpos, ypos + i);
-         }
-         else {
-            rb->GetRow(ctx, rb, width, xpos, ypos + i, accumRow);
-            acc = accumRow;
-         }
-
-         /* read colors from color buffer */
-         _swrast_read_rgba_span(ctx, ctx->ReadBuffer->_ColorReadBuffer, width,
-                                xpos, ypos + i, CHAN_TYPE, rgba);
-
-         /* do accumulation */
-         if (swrast->_IntegerAccumMode) {
-            /* simply add integer color values into accum buffer */
-            GLint j;
-            for (j = 0; j < width; j++) {
-               acc[j * 4 + 0] += rgba[j][RCOMP];
-               acc[j * 4 + 1] += rgba[j][GCOMP];
-               acc[j * 4 + 2] += rgba[j][BCOMP];
-               acc[j * 4 + 3] += rgba[j][ACOMP];
-            }
-         }
-         else {
-            /* scaled integer (or float) accum buffer */
-            GLint j;
-            for (j = 0; j < width; j++) {
-               acc[j * 4 + 0] += (GLshort) ((GLfloat) rgba[j][RCOMP] * scale);
-               acc[j * 4 + 1] += (GLshort) ((GLfloat) rgba[j][GCOMP] * scale);
-               acc[j * 4 + 2] += (GLshort) ((GLfloat) rgba[j][BCOMP] * scale);
-               acc[j * 4 + 3] += (GLshort) ((GLfloat) rgba[j][ACOMP] * scale);
-            }
-         }
-
-         if (!directAccess) {
-            rb->PutRow(ctx, rb, width, xpos, ypos + i, accumRow, NULL);
-         }
-      }
-   }
-   else {
-      /* other types someday */
-   }
+   run_accum_job(&job, ypos, height);
 }
 
 
@@ -350,11 +541,9 @@ accum_load(GLcontext *ctx, GLfloat value,
            GLint xpos, GLint ypos, GLint width, GLint height )
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
-   struct gl_renderbuffer *rb
-      = ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer;
-   const GLboolean directAccess = (rb->GetPointer(ctx, rb, 0, 0) != NULL);
+   struct accum_job job;
 
-   assert(rb);
+   assert(ctx->DrawBuffer->Attachment[BUFFER_ACCUM].Renderbuffer);
 
    if (!ctx->ReadBuffer->_ColorReadBuffer) {
       /* no read buffer - OK */
@@ -375,55 +564,8 @@ accum_load(GLcontext *ctx, GLfloat value,
       swrast->_IntegerAccumScaler = 0.0;
    }
 
-   if (rb->DataType == GL_SHORT || rb->DataType == GL_UNSIGNED_SHORT) {
-      const GLfloat scale = value * ACCUM_SCALE16 / CHAN_MAXF;
-      GLshort accumRow[4 * MAX_WIDTH];
-      GLchan rgba[MAX_WIDTH][4];
-      GLint i;
-
-      for (i = 0; i < height; i++) {
-         GLshort *acc;
-         if (directAccess) {
-            acc = (GLshort *) rb->GetPointer(ctx, rb, xpos, ypos + i);
-         }
-         else {
-            rb->GetRow(ctx, rb, width, xpos, ypos + i, accumRow);
-            acc = accumRow;
-         }
-
-         /* read colors from color buffer */
-         _swrast_read_rgba_span(ctx, ctx->ReadBuffer->_ColorReadBuffer, width,
-                                xpos, ypos + i, CHAN_TYPE, rgba);
-
-         /* do load */
-         if (swrast->_IntegerAccumMode) {
-            /* just copy values in */
-            GLint j;
-            assert(swrast->_IntegerAccumScaler > 0.0);
-            assert(swrast->_IntegerAccumScaler <= 1.0);
-            for (j = 0; j < width; j++) {
-               acc[j * 4 + 0] = rgba[j][RCOMP];
-               acc[j * 4 + 1] = rgba[j][GCOMP];
-               acc[j * 4 + 2] = rgba[j][BCOMP];
-               acc[j * 4 + 3] = rgba[j][ACOMP];
-            }
-         }
-         else {
-            /* scaled integer (or float) accum buffer */
-            GLint j;
-            for (j = 0; j < width; j++) {
-               acc[j * 4 + 0] = (GLshort) ((GLfloat) rgba[j][RCOMP] * scale);
-               acc[j * 4 + 1] = (GLshort) ((GLfloat) rgba[j][GCOMP] * scale);
-               acc[j * 4 + 2] = (GLshort) ((GLfloat) rgba[j][BCOMP] * scale);
-               acc[j * 4 + 3] = (GLshort) ((GLfloat) rgba[j][ACOMP] * scale);
-            }
-         }
-
-         if (!directAccess) {
-            rb->PutRow(ctx, rb, width, xpos, ypos + i, accumRow, NULL);
-         }
-      }
-   }
+   init_accum_job(&job, ctx, GL_LOAD, value, xpos, width);
+   run_accum_job(&job, ypos, height);
 }
 
 
@@ -432,111 +574,26 @@ accum_return(GLcontext *ctx, GLfloat value,
              GLint xpos, GLint ypos, GLint width, GLint height )
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
-   struct gl_framebuffer *fb = ctx->DrawBuffer;
-   struct gl_renderbuffer *accumRb = fb->Attachment[BUFFER_ACCUM].Renderbuffer;
-   const GLboolean directAccess
-      = (accumRb->GetPointer(ctx, accumRb, 0, 0) != NULL);
-   const GLboolean masking = (!ctx->Color.ColorMask[RCOMP] ||
-                              !ctx->Color.ColorMask[GCOMP] ||
-                              !ctx->Color.ColorMask[BCOMP] ||
-                              !ctx->Color.ColorMask[ACOMP]);
-
-   static GLchan multTable[32768];
-   static GLfloat prevMult = 0.0;
-   const GLfloat mult = swrast->_IntegerAccumScaler;
-   const GLint max = MIN2((GLint) (256 / mult), 32767);
-
-   /* May have to leave optimized accum buffer mode */
-   if (swrast->_IntegerAccumMode && value != 1.0)
-      rescale_accum(ctx);
+   struct accum_job job;
+   GLfloat scale;
 
-   if (swrast->_IntegerAccumMode && swrast->_IntegerAccumScaler > 0) {
-      /* build lookup table to avoid many floating point multiplies */
-      GLint j;
+   if (swrast->_IntegerAccumMode) {
+      /* The unscaled values only need multiplying by the implicit scale
+       * factor as well, so there's no need to leave optimized mode.
+       */
       assert(swrast->_IntegerAccumScaler <= 1.0);
-      if (mult != prevMult) {
-         for (j = 0; j < max; j++)
-            multTable[j] = IROUND((GLfloat) j * mult);
-         prevMult = mult;
-      }
-   }
-
-   if (accumRb->DataType == GL_SHORT ||
-       accumRb->DataType == GL_UNSIGNED_SHORT) {
-      const GLfloat scale = value * CHAN_MAXF / ACCUM_SCALE16;
-      GLuint buffer;
-      GLint i;
-
-      /* XXX maybe transpose the 'i' and 'buffer' loops??? */
-      for (i = 0; i < height; i++) {
-         GLshort accumRow[4 * MAX_WIDTH];
-         GLshort *acc;
-         SWspan span;
-
-         /* init color span */
-         INIT_SPAN(span, GL_BITMAP);
-         span.end = width;
-         span.arrayMask = SPAN_RGBA;
-         span.x = xpos;
-         span.y = ypos + i;
-
-         if (directAccess) {
-            acc = (GLshort *) accumRb->GetPointer(ctx, accumRb, xpos, ypos +i);
-         }
-         else {
-            accumRb->GetRow(ctx, accumRb, width, xpos, ypos + i, accumRow);
-            acc = accumRow;
-         }
-
-         /* get the colors to return */
-         if (swrast->_IntegerAccumMode) {
-            GLint j;
-            for (j = 0; j < width; j++) {
-               ASSERT(acc[j * 4 + 0] < max);
-               ASSERT(acc[j * 4 + 1] < max);
-               ASSERT(acc[j * 4 + 2] < max);
-               ASSERT(acc[j * 4 + 3] < max);
-               span.array->rgba[j][RCOMP] = multTable[acc[j * 4 + 0]];
-               span.array->rgba[j][GCOMP] = multTable[acc[j * 4 + 1]];
-               span.array->rgba[j][BCOMP] = multTable[acc[j * 4 + 2]];
-               span.array->rgba[j][ACOMP] = multTable[acc[j * 4 + 3]];
-            }
-         }
-         else {
-            /* scaled integer (or float) accum buffer */
-            GLint j;
-            for (j = 0; j < width; j++) {
-#if CHAN_BITS==32
-               GLchan r = acc[j * 4 + 0] * scale;
-               GLchan g = acc[j * 4 + 1] * scale;
-               GLchan b = acc[j * 4 + 2] * scale;
-               GLchan a = acc[j * 4 + 3] * scale;
-#else
-               GLint r = IROUND( (GLfloat) (acc[j * 4 + 0]) * scale );
-               GLint g = IROUND( (GLfloat) (acc[j * 4 + 1]) * scale );
-               GLint b = IROUND( (GLfloat) (acc[j * 4 + 2]) * scale );
-               GLint a = IROUND( (GLfloat) (acc[j * 4 + 3]) * scale );
-#endif
-               span.array->rgba[j][RCOMP] = CLAMP( r, 0, CHAN_MAX );
-               span.array->rgba[j][GCOMP] = CLAMP( g, 0, CHAN_MAX );
-               span.array->rgba[j][BCOMP] = CLAMP( b, 0, CHAN_MAX );
-               span.array->rgba[j][ACOMP] = CLAMP( a, 0, CHAN_MAX );
-            }
-         }
-
-         /* store colors */
-         for (buffer = 0; buffer < fb->_NumColorDrawBuffers; buffer++) {
-            struct gl_renderbuffer *rb = fb->_ColorDrawBuffers[buffer];
-            if (masking) {
-               _swrast_mask_rgba_span(ctx, rb, &span);
-            }
-            rb->PutRow(ctx, rb, width, xpos, ypos + i, span.array->rgba, NULL);
-         }
-      }
+      scale = swrast->_IntegerAccumScaler * value;
    }
    else {
-      /* other types someday */
+      scale = value * CHAN_MAXF / ACCUM_SCALE16;
    }
+
+   init_accum_job(&job, ctx, GL_RETURN, scale, xpos, width);
+   job.masking = (!ctx->Color.ColorMask[RCOMP] ||
+                  !ctx->Color.ColorMask[GCOMP] ||
+                  !ctx->Color.ColorMask[BCOMP] ||
+                  !ctx->Color.ColorMask[ACOMP]);
+   run_accum_job(&job, ypos, height);
 }
 
 
@@ -25,6 +25,7 @@
 
 #include "main/glheader.h"
 #include "main/macros.h"
+#include "main/rowthreads.h"
 #include "s_context.h"
 
 
@@ -33,56 +34,31 @@
 
 /**
  * Generate a row resampler function for GL_NEAREST mode.
+ * srcCol[] holds the source column of each dest column, flipped if needed.
  */
 #define RESAMPLE(NAME, PIXELTYPE, SIZE)			\
 static void						\
-NAME(GLint srcWidth, GLint dstWidth,			\
-     const GLvoid *srcBuffer, GLvoid *dstBuffer,	\
-     GLboolean flip)					\
+NAME(GLint dstWidth, const GLint srcCol[],		\
+     const GLvoid *srcBuffer, GLvoid *dstBuffer)	\
 {							\
    const PIXELTYPE *src = (const PIXELTYPE *) srcBuffer;\
    PIXELTYPE *dst = (PIXELTYPE *) dstBuffer;		\
    GLint dstCol;					\
 							\
-   if (flip) {						\
-      for (dstCol = 0; dstCol < dstWidth; dstCol++) {	\
-         GLint srcCol = (dstCol * srcWidth) / dstWidth;	\
-         ASSERT(srcCol >= 0);				\
-         ASSERT(srcCol < srcWidth);			\
-         srcCol = srcWidth - 1 - srcCol; /* flip */	\
-         if (SIZE == 1) {				\
-            dst[dstCol] = src[srcCol];			\
-         }						\
-         else if (SIZE == 2) {				\
-            dst[dstCol*2+0] = src[srcCol*2+0];		\
-            dst[dstCol*2+1] = src[srcCol*2+1];		\
-         }						\
-         else if (SIZE == 4) {				\
-            dst[dstCol*4+0] = src[srcCol*4+0];		\
-            dst[dstCol*4+1] = src[srcCol*4+1];		\
-            dst[dstCol*4+2] = src[srcCol*4+2];		\
-            dst[dstCol*4+3] = src[srcCol*4+3];		\
-         }						\
+   for (dstCol = 0; dstCol < dstWidth; dstCol++) {	\
+      const GLint i = srcCol[dstCol];			\
+      if (SIZE == 1) {					\
+         dst[dstCol] = src[i];				\
       }							\
-   }							\
-   else {						\
-      for (dstCol = 0; dstCol < dstWidth; dstCol++) {	\
-         GLint srcCol = (dstCol * srcWidth) / dstWidth;	\
-         ASSERT(srcCol >= 0);				\
-         ASSERT(srcCol < srcWidth);			\
-         if (SIZE == 1) {				\
-            dst[dstCol] = src[srcCol];			\
-         }						\
-         else if (SIZE == 2) {				\
-            dst[dstCol*2+0] = src[srcCol*2+0];		\
-            dst[dstCol*2+1] = src[srcCol*2+1];		\
-         }						\
-         else if (SIZE == 4) {				\
-            dst[dstCol*4+0] = src[srcCol*4+0];		\
-            dst[dstCol*4+1] = src[srcCol*4+1];		\
-            dst[dstCol*4+2] = src[srcCol*4+2];		\
-            dst[dstCol*4+3] = src[srcCol*4+3];		\
-         }						\
+      else if (SIZE == 2) {				\
+         dst[dstCol*2+0] = src[i*2+0];			\
+         dst[dstCol*2+1] = src[i*2+1];			\
+      }							\
+      else if (SIZE == 4) {				\
+         dst[dstCol*4+0] = src[i*4+0];			\
+         dst[dstCol*4+1] = src[i*4+1];			\
+         dst[dstCol*4+2] = src[i*4+2];			\
+         dst[dstCol*4+3] = src[i*4+3];			\
       }							\
    }							\
 }
@@ -97,6 +73,367 @@ RESAMPLE(resample_row_8, GLuint, 2)
 RESAMPLE(resample_row_16, GLuint, 4)
 
 
+#define LERP(T, A, B)  ( (A) + (T) * ((B) - (A)) )
+
+
+/**
+ * Generate a function which does the horizontal half of GL_LINEAR
+ * filtering: interpolate one source row of RGBA pixels at the dest
+ * columns, giving 4 * dstWidth floats.  Each source row is only done
+ * once no matter how many dest rows sample it.
+ */
+#define RESAMPLE_LINEAR(NAME, CHANTYPE)				\
+static void							\
+NAME(GLint dstWidth, const GLint srcCol0[], const GLint srcCol1[],\
+     const GLfloat colWeight[], const GLvoid *srcBuffer,	\
+     GLfloat dst[])						\
+{								\
+   const CHANTYPE (*src)[4] = (const CHANTYPE (*)[4]) srcBuffer;\
+   GLint dstCol;						\
+								\
+   for (dstCol = 0; dstCol < dstWidth; dstCol++) {		\
+      const CHANTYPE *s0 = src[srcCol0[dstCol]];		\
+      const CHANTYPE *s1 = src[srcCol1[dstCol]];		\
+      const GLfloat a = colWeight[dstCol];			\
+      dst[dstCol*4+0] = LERP(a, (GLfloat) s0[0], (GLfloat) s1[0]);\
+      dst[dstCol*4+1] = LERP(a, (GLfloat) s0[1], (GLfloat) s1[1]);\
+      dst[dstCol*4+2] = LERP(a, (GLfloat) s0[2], (GLfloat) s1[2]);\
+      dst[dstCol*4+3] = LERP(a, (GLfloat) s0[3], (GLfloat) s1[3]);\
+   }								\
+}
+
+/**
+ * Generate a function which does the vertical half of GL_LINEAR
+ * filtering: interpolate between two horizontally resampled rows and
+ * store the result as CHANTYPE.  The values are never negative so the
+ * conversion's truncation is the same as IFLOOR.
+ */
+#define STORE_LINEAR(NAME, CHANTYPE)				\
+static void							\
+NAME(GLint n, const GLfloat row0[], const GLfloat row1[],	\
+     GLfloat rowWeight, GLvoid *dstBuffer)			\
+{								\
+   CHANTYPE *dst = (CHANTYPE *) dstBuffer;			\
+   GLint i;							\
+								\
+   for (i = 0; i < n; i++) {					\
+      dst[i] = (CHANTYPE) LERP(rowWeight, row0[i], row1[i]);	\
+   }								\
+}
+
+RESAMPLE_LINEAR(resample_linear_row_ub, GLubyte)
+RESAMPLE_LINEAR(resample_linear_row_us, GLushort)
+RESAMPLE_LINEAR(resample_linear_row_f, GLfloat)
+
+STORE_LINEAR(store_linear_row_ub, GLubyte)
+STORE_LINEAR(store_linear_row_us, GLushort)
+STORE_LINEAR(store_linear_row_f, GLfloat)
+
+
+typedef void (*resample_func)(GLint dstWidth, const GLint srcCol[],
+                              const GLvoid *srcBuffer, GLvoid *dstBuffer);
+
+typedef void (*resample_linear_func)(GLint dstWidth, const GLint srcCol0[],
+                                     const GLint srcCol1[],
+                                     const GLfloat colWeight[],
+                                     const GLvoid *srcBuffer, GLfloat dst[]);
+
+typedef void (*store_linear_func)(GLint n, const GLfloat row0[],
+                                  const GLfloat row1[], GLfloat rowWeight,
+                                  GLvoid *dstBuffer);
+
+
+/**
+ * A scaled blit, shared by all the threads doing it.  Each thread has
+ * its own row buffers.
+ */
+struct blit_job
+{
+   GLcontext *ctx;
+   GLenum filter;
+   struct gl_renderbuffer *readRb, *drawRb;
+   GLboolean directRead;   /**< read source rows through GetPointer */
+   GLboolean directDraw;   /**< write dest rows through GetPointer */
+   GLint pixelSize;
+
+   GLint srcXpos, srcYpos, srcWidth, srcHeight;
+   GLint dstXpos, dstYpos, dstWidth, dstHeight;
+   GLboolean invertY;
+
+   /* per dest column source coordinates, shared by all threads */
+   const GLint *srcCol0, *srcCol1;
+   const GLfloat *colWeight;
+
+   resample_func resampleRow;                /**< GL_NEAREST */
+   resample_linear_func resampleLinearRow;   /**< GL_LINEAR */
+   store_linear_func storeLinearRow;         /**< GL_LINEAR */
+
+   GLubyte *buffers;        /**< row buffers of all threads */
+   GLuint bufferSize;       /**< bytes of row buffers per thread */
+};
+
+
+/**
+ * Get a pointer to the source pixels of row srcY, fetching them into
+ * the given buffer if the read renderbuffer isn't directly addressable.
+ */
+static INLINE const GLvoid *
+get_src_row(const struct blit_job *job, GLint srcY, GLvoid *buffer)
+{
+   GLcontext *ctx = job->ctx;
+   struct gl_renderbuffer *readRb = job->readRb;
+
+   if (job->directRead)
+      return readRb->GetPointer(ctx, readRb, job->srcXpos, srcY);
+
+   readRb->GetRow(ctx, readRb, job->srcWidth, job->srcXpos, srcY, buffer);
+   return buffer;
+}
+
+
+/**
+ * Blit dest rows [y0, y1) with GL_NEAREST filtering.
+ */
+static void
+blit_nearest_rows(const struct blit_job *job, GLubyte *buffer,
+                  GLint y0, GLint y1)
+{
+   GLcontext *ctx = job->ctx;
+   struct gl_renderbuffer *drawRb = job->drawRb;
+   const GLint dstWidth = job->dstWidth;
+   GLubyte *srcBuffer = buffer;
+   GLubyte *dstBuffer = srcBuffer + job->pixelSize * job->srcWidth;
+   GLvoid *prevDst = NULL;
+   GLint prevY = -1;
+   GLint dstRow;
+
+   for (dstRow = y0; dstRow < y1; dstRow++) {
+      const GLint dstY = job->dstYpos + dstRow;
+      GLint srcRow = (dstRow * job->srcHeight) / job->dstHeight;
+      GLint srcY;
+      GLvoid *dst;
+
+      ASSERT(srcRow >= 0);
+      ASSERT(srcRow < job->srcHeight);
+
+      if (job->invertY) {
+         srcRow = job->srcHeight - 1 - srcRow;
+      }
+
+      srcY = job->srcYpos + srcRow;
+
+      dst = job->directDraw
+         ? drawRb->GetPointer(ctx, drawRb, job->dstXpos, dstY) : dstBuffer;
+
+      /* get pixel row from source and resample to match dest width */
+      if (prevY != srcY) {
+         (*job->resampleRow)(dstWidth, job->srcCol0,
+                             get_src_row(job, srcY, srcBuffer), dst);
+         prevY = srcY;
+      }
+      else if (dst != prevDst) {
+         /* same source row as the previous dest row */
+         _mesa_memcpy(dst, prevDst, job->pixelSize * dstWidth);
+      }
+      prevDst = dst;
+
+      /* store pixel row in destination */
+      if (!job->directDraw)
+         drawRb->PutRow(ctx, drawRb, dstWidth, job->dstXpos, dstY, dst, NULL);
+   }
+}
+
+
+/**
+ * Blit dest rows [y0, y1) with bilinear filtering (color only).
+ */
+static void
+blit_linear_rows(const struct blit_job *job, GLubyte *buffer,
+                 GLint y0, GLint y1)
+{
+   GLcontext *ctx = job->ctx;
+   struct gl_renderbuffer *drawRb = job->drawRb;
+   const GLint srcHeight = job->srcHeight;
+   const GLint dstWidth = job->dstWidth;
+   const GLfloat dstHeightF = (GLfloat) job->dstHeight;
+   const GLint n = 4 * dstWidth;
+   /* two adjacent src rows, resampled to the dest width */
+   GLfloat *rowBuffer0 = (GLfloat *) buffer;
+   GLfloat *rowBuffer1 = rowBuffer0 + n;
+   GLint rowBufferY0 = -1, rowBufferY1 = -1;
+   GLubyte *srcBuffer = (GLubyte *) (rowBuffer1 + n);
+   GLubyte *dstBuffer = srcBuffer + job->pixelSize * job->srcWidth;
+   GLint dstRow;
+
+   for (dstRow = y0; dstRow < y1; dstRow++) {
+      const GLint dstY = job->dstYpos + dstRow;
+      const GLfloat srcRow = (dstRow * srcHeight) / dstHeightF;
+      GLint srcRow0 = IFLOOR(srcRow);
+      GLint srcRow1 = srcRow0 + 1;
+      GLfloat rowWeight = srcRow - srcRow0; /* fractional part of srcRow */
+      GLint srcY0, srcY1;
+      GLvoid *dst;
+
+      ASSERT(srcRow >= 0);
+      ASSERT(srcRow < srcHeight);
+
+      if (srcRow1 == srcHeight) {
+         /* last row fudge */
+         srcRow1 = srcRow0;
+         rowWeight = 0.0;
+      }
+
+      if (job->invertY) {
+         srcRow0 = srcHeight - 1 - srcRow0;
+         srcRow1 = srcHeight - 1 - srcRow1;
+      }
+
+      srcY0 = job->srcYpos + srcRow0;
+      srcY1 = job->srcYpos + srcRow1;
+
+      /* get the two resampled source rows */
+      if (srcY0 == rowBufferY0 && srcY1 == rowBufferY1) {
+         /* use same row buffers again */
+      }
+      else if (srcY0 == rowBufferY1) {
+         /* move buffer1 into buffer0 by swapping pointers */
+         GLfloat *tmp = rowBuffer0;
+         rowBuffer0 = rowBuffer1;
+         rowBuffer1 = tmp;
+         /* get y1 row */
+         (*job->resampleLinearRow)(dstWidth, job->srcCol0, job->srcCol1,
+                                   job->colWeight,
+                                   get_src_row(job, srcY1, srcBuffer),
+                                   rowBuffer1);
+         rowBufferY0 = srcY0;
+         rowBufferY1 = srcY1;
+      }
+      else {
+         /* get both new rows */
+         (*job->resampleLinearRow)(dstWidth, job->srcCol0, job->srcCol1,
+                                   job->colWeight,
+                                   get_src_row(job, srcY0, srcBuffer),
+                                   rowBuffer0);
+         (*job->resampleLinearRow)(dstWidth, job->srcCol0, job->srcCol1,
+                                   job->colWeight,
+                                   get_src_row(job, srcY1, srcBuffer),
+                                   rowBuffer1);
+         rowBufferY0 = srcY0;
+         rowBufferY1 = srcY1;
+      }
+
+      dst = job->directDraw
+         ? drawRb->GetPointer(ctx, drawRb, job->dstXpos, dstY) : dstBuffer;
+
+      (*job->storeLinearRow)(n, rowBuffer0, rowBuffer1, rowWeight, dst);
+
+      /* store pixel row in destination */
+      if (!job->directDraw)
+         drawRb->PutRow(ctx, drawRb, dstWidth, job->dstXpos, dstY, dst, NULL);
+   }
+}
+
+
+/**
+ * Blit dest rows [y0, y1), see _mesa_run_row_threads().
+ */
+static void
+blit_rows(void *data, GLuint thread, GLint y0, GLint y1)
+{
+   const struct blit_job *job = (const struct blit_job *) data;
+   GLubyte *buffer = job->buffers + thread * job->bufferSize;
+
+   if (job->filter == GL_NEAREST)
+      blit_nearest_rows(job, buffer, y0, y1);
+   else
+      blit_linear_rows(job, buffer, y0, y1);
+}
+
+
+#define BLIT_MIN_PIXELS_PER_THREAD (64 * 1024)
+
+
+/**
+ * Do all the rows of a scaled blit, with several threads if the
+ * renderbuffers and the blit are big enough.  Only renderbuffers which
+ * are directly addressable are known to be plain memory that may be
+ * accessed by several threads at once.
+ * \param bufferSize  bytes of row buffers each thread needs
+ */
+static void
+run_blit_job(struct blit_job *job, GLuint bufferSize)
+{
+   GLcontext *ctx = job->ctx;
+   GLuint numThreads = 1;
+
+   if (job->directRead && job->directDraw)
+      numThreads = _mesa_num_row_threads(job->dstHeight,
+                                         (GLfloat) job->dstWidth
+                                         * job->dstHeight,
+                                         BLIT_MIN_PIXELS_PER_THREAD);
+
+   /* keep each thread's buffers 16-byte aligned */
+   job->bufferSize = (bufferSize + 15) & ~15;
+
+   job->buffers = (GLubyte *) _mesa_malloc(numThreads * job->bufferSize);
+   if (!job->buffers && numThreads > 1) {
+      numThreads = 1;
+      job->buffers = (GLubyte *) _mesa_malloc(job->bufferSize);
+   }
+   if (!job->buffers) {
+      _mesa_error(ctx, GL_OUT_OF_MEMORY, "glBlitFrameBufferEXT");
+      return;
+   }
+
+   _mesa_run_row_threads(numThreads, 0, job->dstHeight, blit_rows, job);
+
+   _mesa_free(job->buffers);
+}
+
+
+static void
+init_blit_job(struct blit_job *job, GLcontext *ctx, GLenum filter,
+              struct gl_renderbuffer *readRb, struct gl_renderbuffer *drawRb,
+              GLint pixelSize,
+              GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1,
+              GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1)
+{
+   _mesa_bzero(job, sizeof(*job));
+
+   job->ctx = ctx;
+   job->filter = filter;
+   job->readRb = readRb;
+   job->drawRb = drawRb;
+   job->pixelSize = pixelSize;
+
+   /* Reading through a pointer while writing the same buffer could see
+    * rows which were already written, and writing through a pointer
+    * needs the pixels to be laid out the way the read buffer's are.
+    */
+   job->directRead = (readRb != drawRb &&
+                      readRb->GetPointer &&
+                      readRb->GetPointer(ctx, readRb, 0, 0) != NULL);
+   job->directDraw = (drawRb->DataType == readRb->DataType &&
+                      drawRb->_BaseFormat == readRb->_BaseFormat &&
+                      drawRb->_ActualFormat == readRb->_ActualFormat &&
+                      readRb->GetPointer &&
+                      drawRb->GetPointer &&
+                      drawRb->GetPointer(ctx, drawRb, 0, 0) != NULL);
+
+   job->srcWidth = ABS(srcX1 - srcX0);
+   job->dstWidth = ABS(dstX1 - dstX0);
+   job->srcHeight = ABS(srcY1 - srcY0);
+   job->dstHeight = ABS(dstY1 - dstY0);
+
+   job->srcXpos = MIN2(srcX0, srcX1);
+   job->srcYpos = MIN2(srcY0, srcY1);
+   job->dstXpos = MIN2(dstX0, dstX1);
+   job->dstYpos = MIN2(dstY0, dstY1);
+
+   job->invertY = (srcY1 < srcY0) ^ (dstY1 < dstY0);
+}
+
+
 /**
  * Blit color, depth or stencil with GL_NEAREST filtering.
  */
@@ -107,30 +444,11 @@ blit_nearest(GLcontext *ctx,
              GLenum buffer)
 {
    struct gl_renderbuffer *readRb, *drawRb;
-
-   const GLint srcWidth = ABS(srcX1 - srcX0);
-   const GLint dstWidth = ABS(dstX1 - dstX0);
-   const GLint srcHeight = ABS(srcY1 - srcY0);
-   const GLint dstHeight = ABS(dstY1 - dstY0);
-
-   const GLint srcXpos = MIN2(srcX0, srcX1);
-   const GLint srcYpos = MIN2(srcY0, srcY1);
-   const GLint dstXpos = MIN2(dstX0, dstX1);
-   const GLint dstYpos = MIN2(dstY0, dstY1);
-
    const GLboolean invertX = (srcX1 < srcX0) ^ (dstX1 < dstX0);
-   const GLboolean invertY = (srcY1 < srcY0) ^ (dstY1 < dstY0);
-
-   GLint dstRow;
-
+   struct blit_job job;
    GLint comps, pixelSize;
-   GLvoid *srcBuffer, *dstBuffer;
-   GLint prevY = -1;
-
-   typedef void (*resample_func)(GLint srcWidth, GLint dstWidth,
-                                 const GLvoid *srcBuffer, GLvoid *dstBuffer,
-                                 GLboolean flip);
-   resample_func resampleRow;
+   GLint *srcCol;
+   GLint dstCol;
 
    switch (buffer) {
    case GL_COLOR_BUFFER_BIT:
@@ -172,22 +490,25 @@ blit_nearest(GLcontext *ctx,
       return;
    }
 
+   init_blit_job(&job, ctx, GL_NEAREST, readRb, drawRb, pixelSize,
+                 srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1);
+
    /* choose row resampler */
    switch (pixelSize) {
    case 1:
-      resampleRow = resample_row_1;
+      job.resampleRow = resample_row_1;
       break;
    case 2:
-      resampleRow = resample_row_2;
+      job.resampleRow = resample_row_2;
       break;
    case 4:
-      resampleRow = resample_row_4;
+      job.resampleRow = resample_row_4;
       break;
    case 8:
-      resampleRow = resample_row_8;
+      job.resampleRow = resample_row_8;
       break;
    case 16:
-      resampleRow = resample_row_16;
+      job.resampleRow = resample_row_16;
       break;
    default:
       _mesa_problem(ctx, "unexpected pixel size (%d) in blit_nearest",
@@ -195,121 +516,31 @@ blit_nearest(GLcontext *ctx,
       return;
    }
 
-   /* allocate the src/dst row buffers */
-   srcBuffer = _mesa_malloc(pixelSize * srcWidth);
-   if (!srcBuffer) {
-      _mesa_error(ctx, GL_OUT_OF_MEMORY, "glBlitFrameBufferEXT");
-      return;
-   }
-   dstBuffer = _mesa_malloc(pixelSize * dstWidth);
-   if (!dstBuffer) {
-      _mesa_free(srcBuffer);
+   /* source column of each dest column */
+   srcCol = (GLint *) _mesa_malloc(job.dstWidth * sizeof(GLint));
+   if (!srcCol) {
       _mesa_error(ctx, GL_OUT_OF_MEMORY, "glBlitFrameBufferEXT");
       return;
    }
 
-   for (dstRow = 0; dstRow < dstHeight; dstRow++) {
-      const GLint dstY = dstYpos + dstRow;
-      GLint srcRow = (dstRow * srcHeight) / dstHeight;
-      GLint srcY;
-
-      ASSERT(srcRow >= 0);
-      ASSERT(srcRow < srcHeight);
-
-      if (invertY) {
-         srcRow = srcHeight - 1 - srcRow;
-      }
-
-      srcY = srcYpos + srcRow;
-
-      /* get pixel row from source and resample to match dest width */
-      if (prevY != srcY) {
-         readRb->GetRow(ctx, readRb, srcWidth, srcXpos, srcY, srcBuffer);
-         (*resampleRow)(srcWidth, dstWidth, srcBuffer, dstBuffer, invertX);
-         prevY = srcY;
+   for (dstCol = 0; dstCol < job.dstWidth; dstCol++) {
+      GLint col = (dstCol * job.srcWidth) / job.dstWidth;
+      ASSERT(col >= 0);
+      ASSERT(col < job.srcWidth);
+      if (invertX) {
+         col = job.srcWidth - 1 - col;
       }
-
-      /* store pixel row in destination */
-      drawRb->PutRow(ctx, drawRb, dstWidth, dstXpos, dstY, dstBuffer, NULL);
+      srcCol[dstCol] = col;
    }
+   job.srcCol0 = srcCol;
 
-   _mesa_free(srcBuffer);
-   _mesa_free(dstBuffer);
-}
-
-
-
-#define LERP(T, A, B)  ( (A) + (T) * ((B) - (A)) )
-
-static INLINE GLfloat
-lerp_2d(GLfloat a, GLfloat b,
-        GLfloat v00, GLfloat v10, GLfloat v01, GLfloat v11)
-{
-   const GLfloat temp0 = LERP(a, v00, v10);
-   const GLfloat temp1 = LERP(a, v01, v11);
-   return LERP(b, temp0, temp1);
-}
-
-
-/**
- * Bilinear interpolation of two source rows.
- * GLubyte pixels.
- */
-static void
-resample_linear_row_ub(GLint srcWidth, GLint dstWidth,
-                       const GLvoid *srcBuffer0, const GLvoid *srcBuffer1,
-                       GLvoid *dstBuffer, GLboolean flip, GLfloat rowWeight)
-{
-   const GLubyte (*srcColor0)[4] = (const GLubyte (*)[4]) srcBuffer0;
-   const GLubyte (*srcColor1)[4] = (const GLubyte (*)[4]) srcBuffer1;
-   GLubyte (*dstColor)[4] = (GLubyte (*)[4]) dstBuffer;
-   const GLfloat dstWidthF = (GLfloat) dstWidth;
-   GLint dstCol;
-
-   for (dstCol = 0; dstCol < dstWidth; dstCol++) {
-      const GLfloat srcCol = (dstCol * srcWidth) / dstWidthF;
-      GLint srcCol0 = IFLOOR(srcCol);
-      GLint srcCol1 = srcCol0 + 1;
-      GLfloat colWeight = srcCol - srcCol0; /* fractional part of srcCol */
-      GLfloat red, green, blue, alpha;
-
-      ASSERT(srcCol0 >= 0);
-      ASSERT(srcCol0 < srcWidth);
-      ASSERT(srcCol1 <= srcWidth);
-
-      if (srcCol1 == srcWidth) {
-         /* last column fudge */
-         srcCol1--;
-         colWeight = 0.0;
-      }
-
-      if (flip) {
-         srcCol0 = srcWidth - 1 - srcCol0;
-         srcCol1 = srcWidth - 1 - srcCol1;
-      }
+   /* src/dst row buffers */
+   run_blit_job(&job, pixelSize * (job.srcWidth + job.dstWidth));
 
-      red = lerp_2d(colWeight, rowWeight,
-                    srcColor0[srcCol0][RCOMP], srcColor0[srcCol1][RCOMP],
-                    srcColor1[srcCol0][RCOMP], srcColor1[srcCol1][RCOMP]);
-      green = lerp_2d(colWeight, rowWeight,
-                    srcColor0[srcCol0][GCOMP], srcColor0[srcCol1][GCOMP],
-                    srcColor1[srcCol0][GCOMP], srcColor1[srcCol1][GCOMP]);
-      blue = lerp_2d(colWeight, rowWeight,
-                    srcColor0[srcCol0][BCOMP], srcColor0[srcCol1][BCOMP],
-                    srcColor1[srcCol0][BCOMP], srcColor1[srcCol1][BCOMP]);
-      alpha = lerp_2d(colWeight, rowWeight,
-                    srcColor0[srcCol0][ACOMP], srcColor0[srcCol1][ACOMP],
-                    srcColor1[srcCol0][ACOMP], srcColor1[srcCol1][ACOMP]);
-      
-      dstColor[dstCol][RCOMP] = IFLOOR(red);
-      dstColor[dstCol][GCOMP] = IFLOOR(green);
-      dstColor[dstCol][BCOMP] = IFLOOR(blue);
-      dstColor[dstCol][ACOMP] = IFLOOR(alpha);
-   }
+   _mesa_free(srcCol);
 }
 
 
-
 /**
  * Bilinear filtered blit (color only).
  */
@@ -320,27 +551,13 @@ blit_linear(GLcontext *ctx,
 {
    struct gl_renderbuffer *readRb = ctx->ReadBuffer->_ColorReadBuffer;
    struct gl_renderbuffer *drawRb = ctx->DrawBuffer->_ColorDrawBuffers[0];
-
-   const GLint srcWidth = ABS(srcX1 - srcX0);
-   const GLint dstWidth = ABS(dstX1 - dstX0);
-   const GLint srcHeight = ABS(srcY1 - srcY0);
-   const GLint dstHeight = ABS(dstY1 - dstY0);
-   const GLfloat dstHeightF = (GLfloat) dstHeight;
-
-   const GLint srcXpos = MIN2(srcX0, srcX1);
-   const GLint srcYpos = MIN2(srcY0, srcY1);
-   const GLint dstXpos = MIN2(dstX0, dstX1);
-   const GLint dstYpos = MIN2(dstY0, dstY1);
-
    const GLboolean invertX = (srcX1 < srcX0) ^ (dstX1 < dstX0);
-   const GLboolean invertY = (srcY1 < srcY0) ^ (dstY1 < dstY0);
-
-   GLint dstRow;
-
+   struct blit_job job;
    GLint pixelSize;
-   GLvoid *srcBuffer0, *srcBuffer1;
-   GLint srcBufferY0 = -1, srcBufferY1 = -1;
-   GLvoid *dstBuffer;
+   GLint *srcCol0, *srcCol1;
+   GLfloat *colWeight;
+   GLfloat dstWidthF;
+   GLint srcWidth, dstWidth, dstCol;
 
    switch (readRb->DataType) {
    case GL_UNSIGNED_BYTE:
@@ -349,102 +566,80 @@ blit_linear(GLcontext *ctx,
    case GL_UNSIGNED_SHORT:
       pixelSize = 4 * sizeof(GLushort);
       break;
-   case GL_UNSIGNED_INT:
-      pixelSize = 4 * sizeof(GLuint);
-      break;
    case GL_FLOAT:
       pixelSize = 4 * sizeof(GLfloat);
       break;
    default:
-      _mesa_problem(ctx, "unexpected buffer type (0x%x) in blit_nearest",
-                    readRb->DataType);
+      _mesa_problem(ctx, "Unsupported color channel type in sw blit");
       return;
    }
 
-   /* Allocate the src/dst row buffers.
-    * Keep two adjacent src rows around for bilinear sampling.
-    */
-   srcBuffer0 = _mesa_malloc(pixelSize * srcWidth);
-   if (!srcBuffer0) {
-      _mesa_error(ctx, GL_OUT_OF_MEMORY, "glBlitFrameBufferEXT");
-      return;
-   }
-   srcBuffer1 = _mesa_malloc(pixelSize * srcWidth);
-   if (!srcBuffer1) {
-      _mesa_free(srcBuffer0);
-      _mesa_error(ctx, GL_OUT_OF_MEMORY, "glBlitFrameBufferEXT");
-      return;
+   init_blit_job(&job, ctx, GL_LINEAR, readRb, drawRb, pixelSize,
+                 srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1);
+
+   switch (readRb->DataType) {
+   case GL_UNSIGNED_BYTE:
+      job.resampleLinearRow = resample_linear_row_ub;
+      job.storeLinearRow = store_linear_row_ub;
+      break;
+   case GL_UNSIGNED_SHORT:
+      job.resampleLinearRow = resample_linear_row_us;
+      job.storeLinearRow = store_linear_row_us;
+      break;
+   default:
+      job.resampleLinearRow = resample_linear_row_f;
+      job.storeLinearRow = store_linear_row_f;
+      break;
    }
-   dstBuffer = _mesa_malloc(pixelSize * dstWidth);
-   if (!dstBuffer) {
-      _mesa_free(srcBuffer0);
-      _mesa_free(srcBuffer1);
+
+   srcWidth = job.srcWidth;
+   dstWidth = job.dstWidth;
+   dstWidthF = (GLfloat) dstWidth;
+
+   /* source columns and weight of each dest column */
+   srcCol0 = (GLint *) _mesa_malloc(dstWidth * (2 * sizeof(GLint) +
+                                                sizeof(GLfloat)));
+   if (!srcCol0) {
       _mesa_error(ctx, GL_OUT_OF_MEMORY, "glBlitFrameBufferEXT");
       return;
    }
+   srcCol1 = srcCol0 + dstWidth;
+   colWeight = (GLfloat *) (srcCol1 + dstWidth);
 
-   for (dstRow = 0; dstRow < dstHeight; dstRow++) {
-      const GLint dstY = dstYpos + dstRow;
-      const GLfloat srcRow = (dstRow * srcHeight) / dstHeightF;
-      GLint srcRow0 = IFLOOR(srcRow);
-      GLint srcRow1 = srcRow0 + 1;
-      GLfloat rowWeight = srcRow - srcRow0; /* fractional part of srcRow */
-
-      ASSERT(srcRow >= 0);
-      ASSERT(srcRow < srcHeight);
-
-      if (srcRow1 == srcHeight) {
-         /* last row fudge */
-         srcRow1 = srcRow0;
-         rowWeight = 0.0;
-      }
-
-      if (invertY) {
-         srcRow0 = srcHeight - 1 - srcRow0;
-         srcRow1 = srcHeight - 1 - srcRow1;
-      }
+   for (dstCol = 0; dstCol < dstWidth; dstCol++) {
+      const GLfloat srcCol = (dstCol * srcWidth) / dstWidthF;
+      GLint col0 = IFLOOR(srcCol);
+      GLint col1 = col0 + 1;
+      GLfloat weight = srcCol - col0; /* fractional part of srcCol */
 
-      srcY0 = srcYpos + srcRow0;
-      srcY1 = srcYpos + srcRow1;
+      ASSERT(col0 >= 0);
+      ASSERT(col0 < srcWidth);
+      ASSERT(col1 <= srcWidth);
 
-      /* get the two source rows */
-      if (srcY0 == srcBufferY0 && srcY1 == srcBufferY1) {
-         /* use same source row buffers again */
-      }
-      else if (srcY0 == srcBufferY1) {
-         /* move buffer1 into buffer0 by swapping pointers */
-         GLvoid *tmp = srcBuffer0;
-         srcBuffer0 = srcBuffer1;
-         srcBuffer1 = tmp;
-         /* get y1 row */
-         readRb->GetRow(ctx, readRb, srcWidth, srcXpos, srcY1, srcBuffer1);
-         srcBufferY0 = srcY0;
-         srcBufferY1 = srcY1;
-      }
-      else {
-         /* get both new rows */
-         readRb->GetRow(ctx, readRb, srcWidth, srcXpos, srcY0, srcBuffer0);
-         readRb->GetRow(ctx, readRb, srcWidth, srcXpos, srcY1, srcBuffer1);
-         srcBufferY0 = srcY0;
-         srcBufferY1 = srcY1;
+      if (col1 == srcWidth) {
+         /* last column fudge */
+         col1--;
+         weight = 0.0;
       }
 
-      if (readRb->DataType == GL_UNSIGNED_BYTE) {
-         resample_linear_row_ub(srcWidth, dstWidth, srcBuffer0, srcBuffer1,
-                                dstBuffer, invertX, rowWeight);
-      }
-      else {
-         _mesa_problem(ctx, "Unsupported color channel type in sw blit");
-         break;
+      if (invertX) {
+         col0 = srcWidth - 1 - col0;
+         col1 = srcWidth - 1 - col1;
       }
 
-      /* store pixel row in destination */
-      drawRb->PutRow(ctx, drawRb, dstWidth, dstXpos, dstY, dstBuffer, NULL);
+      srcCol0[dstCol] = col0;
+      srcCol1[dstCol] = col1;
+      colWeight[dstCol] = weight;
    }
+   job.srcCol0 = srcCol0;
+   job.srcCol1 = srcCol1;
+   job.colWeight = colWeight;
+
+   /* two resampled float rows plus src/dst row buffers */
+   run_blit_job(&job, 2 * 4 * dstWidth * sizeof(GLfloat)
+                + pixelSize * (srcWidth + dstWidth));
 
-   _mesa_free(srcBuffer0);
-   _mesa_free(srcBuffer1);
-   _mesa_free(dstBuffer);
+   _mesa_free(srcCol0);
 }
 
 
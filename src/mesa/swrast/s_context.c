@@ -32,6 +32,7 @@
 #include "main/colormac.h"
 #include "main/mtypes.h"
 #include "main/teximage.h"
+#include "shader/prog_instruction.h"
 #include "shader/prog_parameter.h"
 #include "shader/prog_statevars.h"
 #include "swrast.h"
@@ -543,9 +544,48 @@ _swrast_update_texture_samplers(GLcontext *ctx)
 }
 
 
+/**
+ * Return the mask of fragment program inputs for which the program
+ * needs partial derivatives: the operands of DDX/DDY and the texcoords
+ * of texture instructions which compute the LOD from derivatives (see
+ * fetch_texel() in prog_execute.c).
+ */
+static GLbitfield
+fragment_program_deriv_mask(const struct gl_fragment_program *fp)
+{
+   GLbitfield mask = 0x0;
+   GLuint i;
+
+   for (i = 0; i < fp->Base.NumInstructions; i++) {
+      const struct prog_instruction *inst = fp->Base.Instructions + i;
+      const struct prog_src_register *src = &inst->SrcReg[0];
+
+      if (src->File != PROGRAM_INPUT)
+         continue;
+
+      switch (inst->Opcode) {
+      case OPCODE_DDX:
+      case OPCODE_DDY:
+         mask |= 1 << src->Index;
+         break;
+      case OPCODE_TEX:
+      case OPCODE_TXB:
+      case OPCODE_TXP:
+      case OPCODE_TXP_NV:
+         if (src->Index == FRAG_ATTRIB_TEX0 + inst->TexSrcUnit)
+            mask |= 1 << src->Index;
+         break;
+      default:
+         ;
+      }
+   }
+   return mask;
+}
+
+
 /**
  * Update swrast->_ActiveAttribs, swrast->_NumActiveAttribs,
- * swrast->_ActiveAtttribMask.
+ * swrast->_ActiveAtttribMask, swrast->_DerivAttribMask.
  */
 static void
 _swrast_update_active_attribs(GLcontext *ctx)
@@ -560,13 +600,17 @@ _swrast_update_active_attribs(GLcontext *ctx)
       /* fragment program/shader */
       attribsMask = ctx->FragmentProgram._Current->Base.InputsRead;
       attribsMask &= ~FRAG_BIT_WPOS; /* WPOS is always handled specially */
+      swrast->_DerivAttribMask
+         = fragment_program_deriv_mask(ctx->FragmentProgram._Current);
    }
    else if (ctx->ATIFragmentShader._Enabled) {
       attribsMask = ~0;  /* XXX fix me */
+      swrast->_DerivAttribMask = 0x0;
    }
    else {
       /* fixed function */
       attribsMask = 0x0;
+      swrast->_DerivAttribMask = 0x0;
 
 #if CHAN_TYPE == GL_FLOAT
       attribsMask |= FRAG_BIT_COL0;
@@ -640,6 +684,9 @@ _swrast_validate_derived( GLcontext *ctx )
          _swrast_validate_texture_images(ctx);
       }
 
+      if (swrast->NewState & _NEW_TEXTURE)
+         _swrast_flush_texel_block_cache(ctx);
+
       if (swrast->NewState & (_NEW_COLOR | _NEW_PROGRAM))
          _swrast_update_deferred_texture(ctx);
 
@@ -843,6 +890,14 @@ _swrast_DestroyContext( GLcontext *ctx )
    if (swrast->ZoomedArrays)
       FREE( swrast->ZoomedArrays );
    FREE( swrast->TexelBuffer );
+   if (swrast->TexelBlockCache) {
+      if (MESA_VERBOSE & VERBOSE_TEXTURE) {
+         _mesa_debug(ctx, "compressed texel cache: %u hits, %u misses\n",
+                     swrast->TexelBlockCache->Hits,
+                     swrast->TexelBlockCache->Misses);
+      }
+      FREE( swrast->TexelBlockCache );
+   }
    FREE( swrast );
 
    ctx->swrast_context = 0;
@@ -108,6 +108,31 @@ typedef void (*validate_texture_image_func)(GLcontext *ctx,
 			        _NEW_DEPTH)
 
 
+/**
+ * Cache of decoded compressed texture tiles.  Without it, every texel
+ * fetch from a compressed image decodes its whole tile again, so bilinear
+ * filtering decodes each tile dozens of times.  Direct mapped by tile
+ * position, see fetch_compressed_texel().  Entries are keyed by image
+ * and its Stamp, so changes made through other contexts are noticed.
+ */
+#define TEXEL_BLOCK_CACHE_SIZE 256  /**< number of tiles, power of two */
+#define TEXEL_BLOCK_MAX_TEXELS 32   /**< FXT1 tiles are 8x4 */
+
+struct swrast_texel_block
+{
+   const struct gl_texture_image *Image;  /**< NULL if entry is unused */
+   GLuint Stamp;                          /**< Image->Stamp when decoded */
+   GLint Col, Row;                        /**< tile position, in tiles */
+   GLchan Texels[TEXEL_BLOCK_MAX_TEXELS][4];
+};
+
+struct swrast_texel_block_cache
+{
+   struct swrast_texel_block Block[TEXEL_BLOCK_CACHE_SIZE];
+   GLuint Hits, Misses;  /**< statistics */
+};
+
+
 /**
  * \struct SWcontext
  * \brief  Per-context state that's private to the software rasterizer module.
@@ -144,6 +169,8 @@ typedef struct
    GLuint _NumActiveAttribs;
    /** Indicates how each attrib is to be interpolated (lines/tris) */
    GLenum _InterpMode[FRAG_ATTRIB_MAX]; /* GL_FLAT or GL_SMOOTH (for now) */
+   /** Fragment program inputs whose derivatives are used (DDX/DDY/TEX) */
+   GLbitfield _DerivAttribMask;
 
    /* Accum buffer temporaries.
     */
@@ -225,9 +252,23 @@ typedef struct
 
    validate_texture_image_func ValidateTextureImage;
 
+   /** Decoded compressed texture tiles, allocated on first use */
+   struct swrast_texel_block_cache *TexelBlockCache;
+
    /** State used during execution of fragment programs */
    struct gl_program_machine FragProgMachine;
 
+   /**
+    * Partial derivatives of the fragment program inputs for the 2x2 pixel
+    * quad being shaded, and the texture LODs computed from them.
+    */
+   /*@{*/
+   GLfloat QuadDerivX[FRAG_ATTRIB_MAX][4];
+   GLfloat QuadDerivY[FRAG_ATTRIB_MAX][4];
+   GLfloat QuadLambda[MAX_TEXTURE_COORD_UNITS];
+   GLbitfield QuadLambdaValid;
+   /*@}*/
+
 } SWcontext;
 
 
@@ -237,6 +278,9 @@ _swrast_validate_derived( GLcontext *ctx );
 extern void
 _swrast_update_texture_samplers(GLcontext *ctx);
 
+extern void
+_swrast_flush_texel_block_cache(GLcontext *ctx);
+
 
 #define SWRAST_CONTEXT(ctx) ((SWcontext *)ctx->swrast_context)
 
@@ -808,6 +808,55 @@ copy_depth_stencil_pixels(GLcontext *ctx,
 
 
 
+/**
+ * If both renderbuffers are directly addressable and store their pixels
+ * the same way, return the size in bytes of their pixels, else 0.
+ * The caller has checked that they have the same base format and type.
+ */
+static GLuint
+direct_pixel_size(GLcontext *ctx, struct gl_renderbuffer *srcRb,
+                  struct gl_renderbuffer *dstRb)
+{
+   GLuint comps;
+
+   /* the same base format and type may still be stored differently */
+   if (srcRb->_ActualFormat != dstRb->_ActualFormat)
+      return 0;
+
+   if (!srcRb->GetPointer(ctx, srcRb, 0, 0) ||
+       !dstRb->GetPointer(ctx, dstRb, 0, 0))
+      return 0;
+
+   switch (srcRb->_BaseFormat) {
+   case GL_RGBA:
+      comps = 4;
+      break;
+   case GL_COLOR_INDEX:
+   case GL_DEPTH_COMPONENT:
+   case GL_STENCIL_INDEX:
+   case GL_DEPTH_STENCIL_EXT:
+      comps = 1;
+      break;
+   default:
+      return 0;
+   }
+
+   switch (srcRb->DataType) {
+   case GL_UNSIGNED_BYTE:
+      return comps * sizeof(GLubyte);
+   case GL_UNSIGNED_SHORT:
+      return comps * sizeof(GLushort);
+   case GL_UNSIGNED_INT:
+   case GL_UNSIGNED_INT_24_8_EXT:
+      return comps * sizeof(GLuint);
+   case GL_FLOAT:
+      return comps * sizeof(GLfloat);
+   default:
+      return 0;
+   }
+}
+
+
 /**
  * Try to do a fast copy pixels.
  */
@@ -820,8 +869,9 @@ fast_copy_pixels(GLcontext *ctx,
    struct gl_framebuffer *dstFb = ctx->DrawBuffer;
    struct gl_renderbuffer *srcRb, *dstRb;
    GLint row, yStep;
+   GLuint pixelSize;
 
-   if (SWRAST_CONTEXT(ctx)->_RasterMask != 0x0 ||
+   if ((SWRAST_CONTEXT(ctx)->_RasterMask & ~CLIP_BIT) ||
        ctx->Pixel.ZoomX != 1.0F ||
        ctx->Pixel.ZoomY != 1.0F ||
        ctx->_ImageTransferState) {
@@ -857,11 +907,30 @@ fast_copy_pixels(GLcontext *ctx,
       return GL_FALSE;
    }
 
-   /* clipping not supported */
+   /* clip to the destination bounds (window size and scissor) */
+   if (dstX < dstFb->_Xmin) {
+      srcX += dstFb->_Xmin - dstX;
+      width -= dstFb->_Xmin - dstX;
+      dstX = dstFb->_Xmin;
+   }
+   if (dstX + width > dstFb->_Xmax) {
+      width = dstFb->_Xmax - dstX;
+   }
+   if (dstY < dstFb->_Ymin) {
+      srcY += dstFb->_Ymin - dstY;
+      height -= dstFb->_Ymin - dstY;
+      dstY = dstFb->_Ymin;
+   }
+   if (dstY + height > dstFb->_Ymax) {
+      height = dstFb->_Ymax - dstY;
+   }
+   if (width <= 0 || height <= 0) {
+      return GL_TRUE; /* totally clipped */
+   }
+
+   /* source clipping not supported */
    if (srcX < 0 || srcX + width > (GLint) srcFb->Width ||
-       srcY < 0 || srcY + height > (GLint) srcFb->Height ||
-       dstX < dstFb->_Xmin || dstX + width > dstFb->_Xmax ||
-       dstY < dstFb->_Ymin || dstY + height > dstFb->_Ymax) {
+       srcY < 0 || srcY + height > (GLint) srcFb->Height) {
       return GL_FALSE;
    }
 
@@ -877,6 +946,21 @@ fast_copy_pixels(GLcontext *ctx,
       yStep = 1;
    }
 
+   pixelSize = direct_pixel_size(ctx, srcRb, dstRb);
+   if (pixelSize) {
+      /* copy straight from one buffer to the other; rows of the same
+       * buffer may overlap horizontally
+       */
+      for (row = 0; row < height; row++) {
+         _mesa_memmove(dstRb->GetPointer(ctx, dstRb, dstX, dstY),
+                       srcRb->GetPointer(ctx, srcRb, srcX, srcY),
+                       width * pixelSize);
+         srcY += yStep;
+         dstY += yStep;
+      }
+      return GL_TRUE;
+   }
+
    for (row = 0; row < height; row++) {
       GLuint temp[MAX_WIDTH][4];
       srcRb->GetRow(ctx, srcRb, width, srcX, srcY, temp);
@@ -61,6 +61,9 @@ fetch_texel_lod( GLcontext *ctx, const GLfloat texcoord[4], GLfloat lambda,
  * Fetch a texel with the given partial derivatives to compute a level
  * of detail in the mipmap.
  * Called via machine->FetchTexelDeriv()
+ *
+ * When the derivatives are those of a texcoord input for the current
+ * 2x2 quad, the LOD is only computed for the quad's first fragment.
  */
 static void
 fetch_texel_deriv( GLcontext *ctx, const GLfloat texcoord[4],
@@ -73,17 +76,31 @@ fetch_texel_deriv( GLcontext *ctx, const GLfloat texcoord[4],
    GLchan rgba[4];
 
    if (texObj) {
-      const struct gl_texture_image *texImg = texObj->Image[0][texObj->BaseLevel];
-      const GLfloat texW = (GLfloat) texImg->WidthScale;
-      const GLfloat texH = (GLfloat) texImg->HeightScale;
+      GLuint i;
 
-      lambda = _swrast_compute_lambda(texdx[0], texdy[0], /* ds/dx, ds/dy */
-                                      texdx[1], texdy[1], /* dt/dx, dt/dy */
-                                      texdx[3], texdy[2], /* dq/dx, dq/dy */
-                                      texW, texH,
-                                      texcoord[0], texcoord[1], texcoord[3],
-                                      1.0F / texcoord[3]) + lodBias;
+      /* look for texcoord (TEX0 + i) of the current quad */
+      for (i = 0; i < MAX_TEXTURE_COORD_UNITS; i++) {
+         if (texdx == swrast->QuadDerivX[FRAG_ATTRIB_TEX0 + i])
+            break;
+      }
 
+      if (i < MAX_TEXTURE_COORD_UNITS && (swrast->QuadLambdaValid & (1 << i))) {
+         lambda = swrast->QuadLambda[i];
+      }
+      else {
+         const struct gl_texture_image *texImg
+            = texObj->Image[0][texObj->BaseLevel];
+         lambda = _swrast_compute_lambda_deriv(texdx[0], texdy[0],
+                                               texdx[1], texdy[1],
+                                               (GLfloat) texImg->WidthScale,
+                                               (GLfloat) texImg->HeightScale);
+         if (i < MAX_TEXTURE_COORD_UNITS) {
+            swrast->QuadLambda[i] = lambda;
+            swrast->QuadLambdaValid |= (1 << i);
+         }
+      }
+
+      lambda += lodBias;
       lambda = CLAMP(lambda, texObj->MinLod, texObj->MaxLod);
    }
 
@@ -96,6 +113,51 @@ fetch_texel_deriv( GLcontext *ctx, const GLfloat texcoord[4],
 }
 
 
+/**
+ * Compute the partial derivatives of the fragment program inputs listed
+ * in swrast->_DerivAttribMask, from the differences of their values at
+ * the pixels of a 2x2 quad.  (dx, dy) is the position of the quad's
+ * upper-left pixel relative to the span's first pixel.  1/w is computed
+ * once for the quad and shared by all inputs.
+ */
+static void
+compute_quad_derivs(GLcontext *ctx, const SWspan *span, GLint dx, GLint dy)
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   const GLbitfield mask = swrast->_DerivAttribMask;
+   const GLfloat dwdx = span->attrStepX[FRAG_ATTRIB_WPOS][3];
+   const GLfloat dwdy = span->attrStepY[FRAG_ATTRIB_WPOS][3];
+   const GLfloat w00 = span->attrStart[FRAG_ATTRIB_WPOS][3]
+      + dx * dwdx + dy * dwdy;
+   const GLfloat inv00 = (w00 == 0.0F) ? 1.0F : 1.0F / w00;
+   const GLfloat inv10 = (w00 + dwdx == 0.0F) ? 1.0F : 1.0F / (w00 + dwdx);
+   const GLfloat inv01 = (w00 + dwdy == 0.0F) ? 1.0F : 1.0F / (w00 + dwdy);
+
+   ATTRIB_LOOP_BEGIN
+      if (mask & (1 << attr)) {
+         const GLfloat *start = span->attrStart[attr];
+         const GLfloat *stepX = span->attrStepX[attr];
+         const GLfloat *stepY = span->attrStepY[attr];
+         GLuint c;
+         for (c = 0; c < 4; c++) {
+            const GLfloat a00 = start[c] + dx * stepX[c] + dy * stepY[c];
+            const GLfloat v00 = a00 * inv00;
+            swrast->QuadDerivX[attr][c] = (a00 + stepX[c]) * inv10 - v00;
+            swrast->QuadDerivY[attr][c] = (a00 + stepY[c]) * inv01 - v00;
+         }
+      }
+   ATTRIB_LOOP_END
+
+   if (mask & FRAG_BIT_WPOS) {
+      /* window x and y; z isn't available as a plane equation */
+      ASSIGN_4V(swrast->QuadDerivX[FRAG_ATTRIB_WPOS], 1.0F, 0.0F, 0.0F, dwdx);
+      ASSIGN_4V(swrast->QuadDerivY[FRAG_ATTRIB_WPOS], 0.0F, 1.0F, 0.0F, dwdy);
+   }
+
+   swrast->QuadLambdaValid = 0x0;
+}
+
+
 /**
  * Initialize the virtual fragment program machine state prior to running
  * fragment program on a fragment.  This involves initializing the input
@@ -119,8 +181,8 @@ init_machine(GLcontext *ctx, struct gl_program_machine *machine,
    /* Setup pointer to input attributes */
    machine->Attribs = span->array->attribs;
 
-   machine->DerivX = (GLfloat (*)[4]) span->attrStepX;
-   machine->DerivY = (GLfloat (*)[4]) span->attrStepY;
+   machine->DerivX = SWRAST_CONTEXT(ctx)->QuadDerivX;
+   machine->DerivY = SWRAST_CONTEXT(ctx)->QuadDerivY;
    machine->NumDeriv = FRAG_ATTRIB_MAX;
 
    machine->Samplers = program->Base.SamplerUnits;
@@ -150,6 +212,11 @@ init_machine(GLcontext *ctx, struct gl_program_machine *machine,
 
 /**
  * Run fragment program on the pixels in span from 'start' to 'end' - 1.
+ *
+ * Fragments are shaded in 2x2 quads aligned to even window coordinates:
+ * input derivatives (and the texture LODs computed from them) are found
+ * once per quad and shared by its fragments.  Spans with per-pixel x/y
+ * arrays (points, lines) get forward differences at each fragment.
  */
 static void
 run_program(GLcontext *ctx, SWspan *span, GLuint start, GLuint end)
@@ -158,10 +225,27 @@ run_program(GLcontext *ctx, SWspan *span, GLuint start, GLuint end)
    const struct gl_fragment_program *program = ctx->FragmentProgram._Current;
    const GLbitfield outputsWritten = program->Base.OutputsWritten;
    struct gl_program_machine *machine = &swrast->FragProgMachine;
+   const GLboolean needDerivs = swrast->_DerivAttribMask != 0x0;
+   const GLboolean xyArrays = (span->arrayMask & SPAN_XY) != 0;
+   const GLint quadY = (span->y & ~1) - span->y;
+   GLint quadX = -2;  /* no quad yet; quads start at offset -1 or more */
    GLuint i;
 
    for (i = start; i < end; i++) {
       if (span->array->mask[i]) {
+         if (needDerivs) {
+            if (xyArrays) {
+               compute_quad_derivs(ctx, span, i, 0);
+            }
+            else {
+               const GLint x = ((span->x + (GLint) i) & ~1) - span->x;
+               if (x != quadX) {
+                  compute_quad_derivs(ctx, span, x, quadY);
+                  quadX = x;
+               }
+            }
+         }
+
          init_machine(ctx, machine, program, span, i);
 
          if (_mesa_execute_program(ctx, &program->Base, machine)) {
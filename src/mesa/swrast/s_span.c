@@ -163,6 +163,270 @@ _swrast_span_default_attribs(GLcontext *ctx, SWspan *span)
 }
 
 
+/**
+ * Number of pixels of a long span which _swrast_write_rgba_span() runs
+ * through the fragment pipeline at once.
+ */
+#define SPAN_CHUNK_SIZE 128
+
+
+/**
+ * Max number of pixels between exactly computed values with
+ * piecewise-linear perspective correction.
+ */
+#define PERSP_SUBSPAN 16
+
+
+/**
+ * Reciprocals of a span's perspective divisor (w or texture q).
+ *
+ * In exact mode inv[k] is 1/d for every pixel k.
+ *
+ * In piecewise-linear mode (GL_PERSPECTIVE_CORRECTION_HINT = GL_FASTEST)
+ * the span is cut into subspans.  len[k] is the length of the subspan
+ * starting at pixel k, and inv[] is only valid at subspan starts and at
+ * the end of the span, inv[n].  Attributes are computed exactly at those
+ * points and linearly interpolated in between.  A subspan of length 1 is
+ * a pixel which is computed exactly.
+ *
+ * The arrays are MAX_WIDTH sized, so they live in the span arrays
+ * rather than on the stack.
+ */
+struct persp_div
+{
+   GLboolean piecewise;
+   GLfloat *inv;
+   GLubyte *len;
+};
+
+
+/**
+ * Compute the reciprocals of d + k * dddx for a span of n pixels.
+ */
+static void
+setup_persp_div(struct persp_div *pd, GLuint n, GLfloat d, GLfloat dddx,
+                GLboolean piecewise)
+{
+   GLfloat *inv = pd->inv;
+   GLuint k;
+
+   pd->piecewise = piecewise;
+
+   if (!piecewise) {
+      /* Step the divisor first, then do all the divides in a separate
+       * loop which the compiler can vectorize.
+       */
+      for (k = 0; k < n; k++) {
+         inv[k] = d;
+         d += dddx;
+      }
+      for (k = 0; k < n; k++) {
+         inv[k] = (inv[k] == 0.0F) ? 1.0F : 1.0F / inv[k];
+      }
+      return;
+   }
+
+   k = 0;
+   while (k < n) {
+      const GLfloat d0 = d + k * dddx;
+      GLuint len = MIN2(PERSP_SUBSPAN, n - k);
+
+      /* Linear interpolation over len pixels is off by at most
+       * len^2 / 4 * |dddx / d| times the attribute's per-pixel step.
+       * Halve the subspan until that's at most a quarter step.  Where the
+       * perspective is too strong, fall back to exact per-pixel values.
+       */
+      while (len > 2) {
+         const GLfloat d1 = d + (k + len) * dddx;
+         if (d0 * d1 > 0.0F &&
+             FABSF(dddx) * (GLfloat) (len * len) <= MIN2(FABSF(d0), FABSF(d1)))
+            break;
+         len >>= 1;
+      }
+      if (len <= 2)
+         len = 1;
+
+      pd->len[k] = len;
+      inv[k] = (d0 == 0.0F) ? 1.0F : 1.0F / d0;
+      k += len;
+   }
+   d += n * dddx;
+   inv[n] = (d == 0.0F) ? 1.0F : 1.0F / d;
+}
+
+
+/**
+ * Perspective-correct interpolation of one attribute: out[k] = v / d,
+ * where v = start + k * step.  Only the first numDiv components are
+ * divided, the others are just interpolated.
+ */
+static void
+interpolate_persp(const struct persp_div *pd, GLuint n,
+                  const GLfloat start[4], const GLfloat step[4],
+                  GLuint numDiv, GLfloat (*out)[4])
+{
+   const GLfloat *inv = pd->inv;
+   GLuint k, c;
+
+   if (!pd->piecewise) {
+      GLfloat v0 = start[0], v1 = start[1], v2 = start[2], v3 = start[3];
+      const GLfloat dv0 = step[0], dv1 = step[1];
+      const GLfloat dv2 = step[2], dv3 = step[3];
+      if (numDiv == 4) {
+         for (k = 0; k < n; k++) {
+            out[k][0] = v0 * inv[k];
+            out[k][1] = v1 * inv[k];
+            out[k][2] = v2 * inv[k];
+            out[k][3] = v3 * inv[k];
+            v0 += dv0;
+            v1 += dv1;
+            v2 += dv2;
+            v3 += dv3;
+         }
+      }
+      else {
+         ASSERT(numDiv == 3);
+         for (k = 0; k < n; k++) {
+            out[k][0] = v0 * inv[k];
+            out[k][1] = v1 * inv[k];
+            out[k][2] = v2 * inv[k];
+            out[k][3] = v3;
+            v0 += dv0;
+            v1 += dv1;
+            v2 += dv2;
+            v3 += dv3;
+         }
+      }
+      return;
+   }
+
+   k = 0;
+   while (k < n) {
+      const GLuint len = pd->len[k];
+      if (len == 1) {
+         for (c = 0; c < 4; c++) {
+            const GLfloat v = start[c] + k * step[c];
+            out[k][c] = (c < numDiv) ? v * inv[k] : v;
+         }
+      }
+      else {
+         const GLfloat invLen = 1.0F / (GLfloat) len;
+         GLuint i;
+         for (c = 0; c < 4; c++) {
+            GLfloat a0 = start[c] + k * step[c];
+            GLfloat a1 = start[c] + (k + len) * step[c];
+            GLfloat da;
+            if (c < numDiv) {
+               a0 *= inv[k];
+               a1 *= inv[k + len];
+            }
+            da = (a1 - a0) * invLen;
+            for (i = 0; i < len; i++) {
+               out[k + i][c] = a0 + i * da;
+            }
+         }
+      }
+      k += len;
+   }
+}
+
+
+/**
+ * Compute the texture LOD for the pixels of a span.  s, t and q are the
+ * (not yet divided) texcoord components, divided by the divisor in pd.
+ *
+ * Normally the LOD is computed once per 2x2 pixel quad (aligned to even
+ * window coordinates) from the differences of the texcoords at the quad's
+ * pixel centers, like hardware does.  Both pixels of a quad in this span
+ * get the same value, and the quad's other row computes the same value.
+ * x and y are the window coordinates of the span's first pixel; for
+ * spans which don't lie along a row (xyArrays) the LOD is computed per
+ * pixel instead.
+ */
+static void
+interpolate_lambda(const struct persp_div *pd, GLuint n, GLint x, GLint y,
+                   GLboolean xyArrays,
+                   const GLfloat start[4], const GLfloat stepX[4],
+                   const GLfloat stepY[4], GLfloat texW, GLfloat texH,
+                   GLfloat *lambda)
+{
+   const GLfloat dsdx = stepX[0], dsdy = stepY[0];
+   const GLfloat dtdx = stepX[1], dtdy = stepY[1];
+   const GLfloat dqdx = stepX[3], dqdy = stepY[3];
+   const GLfloat *inv = pd->inv;
+   GLuint k;
+
+   if (!pd->piecewise && xyArrays) {
+      GLfloat s = start[0], t = start[1], q = start[3];
+      for (k = 0; k < n; k++) {
+         lambda[k] = _swrast_compute_lambda(dsdx, dsdy, dtdx, dtdy,
+                                            dqdx, dqdy, texW, texH,
+                                            s, t, q, inv[k]);
+         s += dsdx;
+         t += dtdx;
+         q += dqdx;
+      }
+      return;
+   }
+
+   if (!pd->piecewise) {
+      /* offsets of the upper-left pixel of the first quad */
+      const GLint dy = (y & ~1) - y;
+      GLint i = (x & ~1) - x;
+      for (; i < (GLint) n; i += 2) {
+         const GLfloat s00 = start[0] + i * dsdx + dy * dsdy;
+         const GLfloat t00 = start[1] + i * dtdx + dy * dtdy;
+         const GLfloat q00 = start[3] + i * dqdx + dy * dqdy;
+         const GLfloat inv00 = (q00 == 0.0F) ? 1.0F : 1.0F / q00;
+         const GLfloat inv10
+            = (q00 + dqdx == 0.0F) ? 1.0F : 1.0F / (q00 + dqdx);
+         const GLfloat inv01
+            = (q00 + dqdy == 0.0F) ? 1.0F : 1.0F / (q00 + dqdy);
+         const GLfloat s0 = s00 * inv00, t0 = t00 * inv00;
+         const GLfloat l
+            = _swrast_compute_lambda_deriv((s00 + dsdx) * inv10 - s0,
+                                           (s00 + dsdy) * inv01 - s0,
+                                           (t00 + dtdx) * inv10 - t0,
+                                           (t00 + dtdy) * inv01 - t0,
+                                           texW, texH);
+         if (i >= 0)
+            lambda[i] = l;
+         if (i + 1 < (GLint) n)
+            lambda[i + 1] = l;
+      }
+      return;
+   }
+
+   k = 0;
+   while (k < n) {
+      const GLuint len = pd->len[k];
+      const GLfloat l0
+         = _swrast_compute_lambda(dsdx, dsdy, dtdx, dtdy, dqdx, dqdy,
+                                  texW, texH,
+                                  start[0] + k * dsdx, start[1] + k * dtdx,
+                                  start[3] + k * dqdx, inv[k]);
+      if (len == 1) {
+         lambda[k] = l0;
+      }
+      else {
+         const GLuint k1 = k + len;
+         const GLfloat l1
+            = _swrast_compute_lambda(dsdx, dsdy, dtdx, dtdy, dqdx, dqdy,
+                                     texW, texH,
+                                     start[0] + k1 * dsdx,
+                                     start[1] + k1 * dtdx,
+                                     start[3] + k1 * dqdx, inv[k1]);
+         const GLfloat dl = (l1 - l0) / (GLfloat) len;
+         GLuint i;
+         for (i = 0; i < len; i++) {
+            lambda[k + i] = l0 + i * dl;
+         }
+      }
+      k += len;
+   }
+}
+
+
 /**
  * Interpolate the active attributes (and'd with attrMask) to
  * fill in span->array->attribs[].
@@ -173,6 +437,11 @@ static INLINE void
 interpolate_active_attribs(GLcontext *ctx, SWspan *span, GLbitfield attrMask)
 {
    const SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct persp_div pd;
+   GLboolean haveDiv = GL_FALSE;
+
+   pd.inv = span->array->invW;
+   pd.len = span->array->subspanW;
 
    /*
     * Don't overwrite existing array values, such as colors that may have
@@ -182,29 +451,17 @@ interpolate_active_attribs(GLcontext *ctx, SWspan *span, GLbitfield attrMask)
 
    ATTRIB_LOOP_BEGIN
       if (attrMask & (1 << attr)) {
-         const GLfloat dwdx = span->attrStepX[FRAG_ATTRIB_WPOS][3];
-         GLfloat w = span->attrStart[FRAG_ATTRIB_WPOS][3];
-         const GLfloat dv0dx = span->attrStepX[attr][0];
-         const GLfloat dv1dx = span->attrStepX[attr][1];
-         const GLfloat dv2dx = span->attrStepX[attr][2];
-         const GLfloat dv3dx = span->attrStepX[attr][3];
-         GLfloat v0 = span->attrStart[attr][0];
-         GLfloat v1 = span->attrStart[attr][1];
-         GLfloat v2 = span->attrStart[attr][2];
-         GLfloat v3 = span->attrStart[attr][3];
-         GLuint k;
-         for (k = 0; k < span->end; k++) {
-            const GLfloat invW = 1.0f / w;
-            span->array->attribs[attr][k][0] = v0 * invW;
-            span->array->attribs[attr][k][1] = v1 * invW;
-            span->array->attribs[attr][k][2] = v2 * invW;
-            span->array->attribs[attr][k][3] = v3 * invW;
-            v0 += dv0dx;
-            v1 += dv1dx;
-            v2 += dv2dx;
-            v3 += dv3dx;
-            w += dwdx;
+         if (!haveDiv) {
+            /* 1/w is the same for all attributes */
+            setup_persp_div(&pd, span->end,
+                            span->attrStart[FRAG_ATTRIB_WPOS][3],
+                            span->attrStepX[FRAG_ATTRIB_WPOS][3],
+                            ctx->Hint.PerspectiveCorrection == GL_FASTEST);
+            haveDiv = GL_TRUE;
          }
+         interpolate_persp(&pd, span->end, span->attrStart[attr],
+                           span->attrStepX[attr], 4,
+                           span->array->attribs[attr]);
          ASSERT((span->arrayAttribs & (1 << attr)) == 0);
          span->arrayAttribs |= (1 << attr);
       }
@@ -487,6 +744,23 @@ _swrast_compute_lambda(GLfloat dsdx, GLfloat dsdy, GLfloat dtdx, GLfloat dtdy,
 }
 
 
+/**
+ * Compute mipmap LOD from the partial derivatives of the (projected)
+ * texcoords, as found from the differences across a 2x2 pixel quad.
+ * Uses the same approximation as _swrast_compute_lambda().
+ */
+GLfloat
+_swrast_compute_lambda_deriv(GLfloat dsdx, GLfloat dsdy,
+                             GLfloat dtdx, GLfloat dtdy,
+                             GLfloat texW, GLfloat texH)
+{
+   const GLfloat maxU = MAX2(FABSF(dsdx), FABSF(dsdy)) * texW;
+   const GLfloat maxV = MAX2(FABSF(dtdx), FABSF(dtdy)) * texH;
+   const GLfloat rho = MAX2(maxU, maxV);
+   return LOG2(rho);
+}
+
+
 /**
  * Fill in the span.array->attrib[FRAG_ATTRIB_TEXn] arrays from the
  * using the attrStart/Step values.
@@ -503,8 +777,19 @@ interpolate_texcoords(GLcontext *ctx, SWspan *span)
 {
    const GLuint maxUnit
       = (ctx->Texture._EnabledCoordUnits > 1) ? ctx->Const.MaxTextureUnits : 1;
+   const GLboolean useW = ctx->FragmentProgram._Current
+      || ctx->ATIFragmentShader._Enabled;
+   const GLboolean piecewise
+      = ctx->Hint.PerspectiveCorrection == GL_FASTEST;
+   struct persp_div wDiv, qDiv;
+   GLboolean haveWDiv = GL_FALSE;
    GLuint u;
 
+   wDiv.inv = span->array->invW;
+   wDiv.len = span->array->subspanW;
+   qDiv.inv = span->array->invQ;
+   qDiv.len = span->array->subspanQ;
+
    /* XXX CoordUnits vs. ImageUnits */
    for (u = 0; u < maxUnit; u++) {
       if (ctx->Texture._EnabledCoordUnits & (1 << u)) {
@@ -514,17 +799,9 @@ interpolate_texcoords(GLcontext *ctx, SWspan *span)
          GLboolean needLambda;
          GLfloat (*texcoord)[4] = span->array->attribs[attr];
          GLfloat *lambda = span->array->lambda[u];
-         const GLfloat dsdx = span->attrStepX[attr][0];
-         const GLfloat dsdy = span->attrStepY[attr][0];
-         const GLfloat dtdx = span->attrStepX[attr][1];
-         const GLfloat dtdy = span->attrStepY[attr][1];
-         const GLfloat drdx = span->attrStepX[attr][2];
          const GLfloat dqdx = span->attrStepX[attr][3];
-         const GLfloat dqdy = span->attrStepY[attr][3];
-         GLfloat s = span->attrStart[attr][0];
-         GLfloat t = span->attrStart[attr][1];
-         GLfloat r = span->attrStart[attr][2];
-         GLfloat q = span->attrStart[attr][3];
+         const struct persp_div *pd;
+         GLuint i;
 
          if (obj) {
             const struct gl_texture_image *img = obj->Image[0][obj->BaseLevel];
@@ -540,97 +817,62 @@ interpolate_texcoords(GLcontext *ctx, SWspan *span)
             needLambda = GL_FALSE;
          }
 
-         if (needLambda) {
-            GLuint i;
-            if (ctx->FragmentProgram._Current
-                || ctx->ATIFragmentShader._Enabled) {
-               /* do perspective correction but don't divide s, t, r by q */
-               const GLfloat dwdx = span->attrStepX[FRAG_ATTRIB_WPOS][3];
-               GLfloat w = span->attrStart[FRAG_ATTRIB_WPOS][3];
-               for (i = 0; i < span->end; i++) {
-                  const GLfloat invW = 1.0F / w;
-                  texcoord[i][0] = s * invW;
-                  texcoord[i][1] = t * invW;
-                  texcoord[i][2] = r * invW;
-                  texcoord[i][3] = q * invW;
-                  lambda[i] = _swrast_compute_lambda(dsdx, dsdy, dtdx, dtdy,
-                                                     dqdx, dqdy, texW, texH,
-                                                     s, t, q, invW);
-                  s += dsdx;
-                  t += dtdx;
-                  r += drdx;
-                  q += dqdx;
-                  w += dwdx;
-               }
+         if (!useW && !needLambda && dqdx == 0.0F) {
+            /* Ortho projection or polygon's parallel to window X axis */
+            const GLfloat dsdx = span->attrStepX[attr][0];
+            const GLfloat dtdx = span->attrStepX[attr][1];
+            const GLfloat drdx = span->attrStepX[attr][2];
+            GLfloat s = span->attrStart[attr][0];
+            GLfloat t = span->attrStart[attr][1];
+            GLfloat r = span->attrStart[attr][2];
+            const GLfloat q = span->attrStart[attr][3];
+            const GLfloat invQ = (q == 0.0F) ? 1.0F : (1.0F / q);
+            for (i = 0; i < span->end; i++) {
+               texcoord[i][0] = s * invQ;
+               texcoord[i][1] = t * invQ;
+               texcoord[i][2] = r * invQ;
+               texcoord[i][3] = q;
+               lambda[i] = 0.0;
+               s += dsdx;
+               t += dtdx;
+               r += drdx;
             }
-            else {
-               for (i = 0; i < span->end; i++) {
-                  const GLfloat invQ = (q == 0.0F) ? 1.0F : (1.0F / q);
-                  texcoord[i][0] = s * invQ;
-                  texcoord[i][1] = t * invQ;
-                  texcoord[i][2] = r * invQ;
-                  texcoord[i][3] = q;
-                  lambda[i] = _swrast_compute_lambda(dsdx, dsdy, dtdx, dtdy,
-                                                     dqdx, dqdy, texW, texH,
-                                                     s, t, q, invQ);
-                  s += dsdx;
-                  t += dtdx;
-                  r += drdx;
-                  q += dqdx;
-               }
+            continue;
+         }
+
+         if (useW) {
+            /* do perspective correction but don't divide s, t, r by q */
+            if (!haveWDiv) {
+               setup_persp_div(&wDiv, span->end,
+                               span->attrStart[FRAG_ATTRIB_WPOS][3],
+                               span->attrStepX[FRAG_ATTRIB_WPOS][3],
+                               piecewise);
+               haveWDiv = GL_TRUE;
             }
+            pd = &wDiv;
+            interpolate_persp(pd, span->end, span->attrStart[attr],
+                              span->attrStepX[attr], 4, texcoord);
+         }
+         else {
+            setup_persp_div(&qDiv, span->end, span->attrStart[attr][3],
+                            dqdx, piecewise);
+            pd = &qDiv;
+            interpolate_persp(pd, span->end, span->attrStart[attr],
+                              span->attrStepX[attr], 3, texcoord);
+         }
+
+         if (needLambda) {
+            interpolate_lambda(pd, span->end, span->x, span->y,
+                               (span->arrayMask & SPAN_XY) != 0,
+                               span->attrStart[attr],
+                               span->attrStepX[attr], span->attrStepY[attr],
+                               texW, texH, lambda);
             span->arrayMask |= SPAN_LAMBDA;
          }
          else {
-            GLuint i;
-            if (ctx->FragmentProgram._Current ||
-                ctx->ATIFragmentShader._Enabled) {
-               /* do perspective correction but don't divide s, t, r by q */
-               const GLfloat dwdx = span->attrStepX[FRAG_ATTRIB_WPOS][3];
-               GLfloat w = span->attrStart[FRAG_ATTRIB_WPOS][3];
-               for (i = 0; i < span->end; i++) {
-                  const GLfloat invW = 1.0F / w;
-                  texcoord[i][0] = s * invW;
-                  texcoord[i][1] = t * invW;
-                  texcoord[i][2] = r * invW;
-                  texcoord[i][3] = q * invW;
-                  lambda[i] = 0.0;
-                  s += dsdx;
-                  t += dtdx;
-                  r += drdx;
-                  q += dqdx;
-                  w += dwdx;
-               }
-            }
-            else if (dqdx == 0.0F) {
-               /* Ortho projection or polygon's parallel to window X axis */
-               const GLfloat invQ = (q == 0.0F) ? 1.0F : (1.0F / q);
-               for (i = 0; i < span->end; i++) {
-                  texcoord[i][0] = s * invQ;
-                  texcoord[i][1] = t * invQ;
-                  texcoord[i][2] = r * invQ;
-                  texcoord[i][3] = q;
-                  lambda[i] = 0.0;
-                  s += dsdx;
-                  t += dtdx;
-                  r += drdx;
-               }
-            }
-            else {
-               for (i = 0; i < span->end; i++) {
-                  const GLfloat invQ = (q == 0.0F) ? 1.0F : (1.0F / q);
-                  texcoord[i][0] = s * invQ;
-                  texcoord[i][1] = t * invQ;
-                  texcoord[i][2] = r * invQ;
-                  texcoord[i][3] = q;
-                  lambda[i] = 0.0;
-                  s += dsdx;
-                  t += dtdx;
-                  r += drdx;
-                  q += dqdx;
-               }
-            }
-         } /* lambda */
+            for (i = 0; i < span->end; i++)
+               lambda[i] = 0.0;
+         }
       } /* if */
    } /* for */
 }
@@ -1230,6 +1472,149 @@ shade_texture_span(GLcontext *ctx, SWspan *span)
 
 
 
+/**
+ * Return the address of pixel (0, 0) of a directly addressable color
+ * renderbuffer and the byte offset between its rows, or NULL.
+ */
+static INLINE GLubyte *
+direct_color_address(GLcontext *ctx, struct gl_renderbuffer *rb,
+                     GLint *rowStride)
+{
+   GLubyte *base = (GLubyte *) rb->GetPointer(ctx, rb, 0, 0);
+   if (base) {
+      if (rb->Height > 1)
+         *rowStride = (GLint) ((GLubyte *) rb->GetPointer(ctx, rb, 0, 1) - base);
+      else
+         *rowStride = 0;
+   }
+   return base;
+}
+
+
+/**
+ * Store a row of pixels of 'words' GLuints each in place, where mask[]
+ * allows.  The select form (rather than a conditional store) lets the
+ * compiler vectorize the loop.
+ */
+static INLINE void
+store_direct_row(GLuint *dst, const GLuint *src, GLuint n,
+                 const GLubyte mask[], const GLuint words)
+{
+   GLuint i, k;
+
+   if (!mask) {
+      _mesa_memcpy(dst, src, n * words * sizeof(GLuint));
+      return;
+   }
+
+   for (i = 0; i < n; i++) {
+      for (k = 0; k < words; k++) {
+         dst[i * words + k] = mask[i] ? src[i * words + k] : dst[i * words + k];
+      }
+   }
+}
+
+
+/**
+ * Store pixels of 'words' GLuints each at x/y positions, where mask[]
+ * allows.
+ */
+static INLINE void
+store_direct_values(GLubyte *base, GLint rowStride, GLuint n,
+                    const GLint x[], const GLint y[],
+                    const GLuint *src, const GLubyte mask[],
+                    const GLuint words)
+{
+   GLuint i, k;
+
+   for (i = 0; i < n; i++) {
+      if (mask[i]) {
+         GLuint *dst = (GLuint *) (base + y[i] * rowStride
+                                   + x[i] * words * sizeof(GLuint));
+         for (k = 0; k < words; k++)
+            dst[k] = src[i * words + k];
+      }
+   }
+}
+
+
+/**
+ * Write the span's colors, which are of the renderbuffer's type, to the
+ * renderbuffer.  If it's directly addressable the pixels are stored in
+ * place, else PutRow/PutValues is called.
+ */
+static void
+put_rgba_span(GLcontext *ctx, struct gl_renderbuffer *rb, const SWspan *span)
+{
+   const GLuint *src = (const GLuint *) span->array->rgba;
+   GLubyte *base;
+   GLint rowStride;
+   GLuint words;
+
+   ASSERT(rb->DataType == span->array->ChanType);
+
+   switch (rb->DataType) {
+   case GL_UNSIGNED_BYTE:
+      words = 1;
+      break;
+   case GL_UNSIGNED_SHORT:
+      words = 2;
+      break;
+   default:
+      words = 4;
+      break;
+   }
+
+   base = direct_color_address(ctx, rb, &rowStride);
+
+   if (span->arrayMask & SPAN_XY) {
+      /* array of pixel coords */
+      if (base) {
+         const GLint *x = span->array->x, *y = span->array->y;
+         const GLubyte *mask = span->array->mask;
+         if (words == 1)
+            store_direct_values(base, rowStride, span->end, x, y, src, mask, 1);
+         else if (words == 2)
+            store_direct_values(base, rowStride, span->end, x, y, src, mask, 2);
+         else
+            store_direct_values(base, rowStride, span->end, x, y, src, mask, 4);
+      }
+      else {
+         ASSERT(rb->PutValues);
+         rb->PutValues(ctx, rb, span->end,
+                       span->array->x, span->array->y,
+                       span->array->rgba, span->array->mask);
+      }
+   }
+   else {
+      /* horizontal run of pixels */
+      const GLubyte *mask = span->writeAll ? NULL : span->array->mask;
+      if (base) {
+         /* clip_span() masks off, but doesn't remove, pixels left of x=0 */
+         const GLint skip = span->x < 0 ? -span->x : 0;
+         const GLuint n = span->end - skip;
+         GLuint *dst = (GLuint *) (base + span->y * rowStride
+                                   + (span->x + skip) * words * sizeof(GLuint));
+         ASSERT(span->x + span->end <= rb->Width);
+         src += skip * words;
+         if (mask)
+            mask += skip;
+         if (words == 1)
+            store_direct_row(dst, src, n, mask, 1);
+         else if (words == 2)
+            store_direct_row(dst, src, n, mask, 2);
+         else
+            store_direct_row(dst, src, n, mask, 4);
+      }
+      else {
+         ASSERT(rb->PutRow);
+         rb->PutRow(ctx, rb, span->end, span->x, span->y,
+                    span->array->rgba, mask);
+      }
+   }
+}
+
+
 /**
  * Apply all the per-fragment operations to a span.
  * This now includes texturing (_swrast_write_texture_span() is history).
@@ -1237,8 +1622,8 @@ shade_texture_span(GLcontext *ctx, SWspan *span)
  * span->interpMask and span->arrayMask may be changed but will be restored
  * to their original values before returning.
  */
-void
-_swrast_write_rgba_span( GLcontext *ctx, SWspan *span)
+static void
+write_rgba_span(GLcontext *ctx, SWspan *span)
 {
    const SWcontext *swrast = SWRAST_CONTEXT(ctx);
    const GLuint colorMask = *((GLuint *) ctx->Color.ColorMask);
@@ -1437,20 +1822,7 @@ _swrast_write_rgba_span( GLcontext *ctx, SWspan *span)
                _swrast_mask_rgba_span(ctx, rb, span);
             }
 
-            if (span->arrayMask & SPAN_XY) {
-               /* array of pixel coords */
-               ASSERT(rb->PutValues);
-               rb->PutValues(ctx, rb, span->end,
-                             span->array->x, span->array->y,
-                             span->array->rgba, span->array->mask);
-            }
-            else {
-               /* horizontal run of pixels */
-               ASSERT(rb->PutRow);
-               rb->PutRow(ctx, rb, span->end, span->x, span->y,
-                          span->array->rgba,
-                          span->writeAll ? NULL: span->array->mask);
-            }
+            put_rgba_span(ctx, rb, span);
 
             if (!multiFragOutputs && numBuffers > 1) {
                /* restore original span values */
@@ -1472,6 +1844,79 @@ end:
 }
 
 
+/**
+ * Advance the interpolants of a horizontal span by n pixels, so that
+ * they describe the span starting at span->x + n.
+ */
+static void
+advance_span_interpolants(GLcontext *ctx, SWspan *span, GLint n)
+{
+   const SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   GLuint c;
+
+   if (span->interpMask & SPAN_RGBA) {
+      span->red += n * span->redStep;
+      span->green += n * span->greenStep;
+      span->blue += n * span->blueStep;
+      span->alpha += n * span->alphaStep;
+   }
+   if (span->interpMask & SPAN_INDEX)
+      span->index += n * span->indexStep;
+   if (span->interpMask & SPAN_Z)
+      span->z += n * span->zStep;
+   span->intTex[0] += n * span->intTexStep[0];
+   span->intTex[1] += n * span->intTexStep[1];
+
+   for (c = 0; c < 4; c++) {
+      span->attrStart[FRAG_ATTRIB_WPOS][c]
+         += n * span->attrStepX[FRAG_ATTRIB_WPOS][c];
+   }
+   ATTRIB_LOOP_BEGIN
+      /* ATI fragment shaders make every attribute active, WPOS included */
+      if (attr != FRAG_ATTRIB_WPOS) {
+         for (c = 0; c < 4; c++) {
+            span->attrStart[attr][c] += n * span->attrStepX[attr][c];
+         }
+      }
+   ATTRIB_LOOP_END
+
+   span->x += n;
+}
+
+
+/**
+ * Apply all the per-fragment operations to a span and write it to the
+ * color buffers.  See write_rgba_span().
+ *
+ * Long horizontal spans which are only described by interpolants are
+ * processed in chunks of SPAN_CHUNK_SIZE pixels.  Each chunk goes through
+ * all the per-fragment stages before the next one is started, so the
+ * span arrays touched by the pipeline stay in the cache instead of being
+ * streamed through memory once per stage.
+ */
+void
+_swrast_write_rgba_span( GLcontext *ctx, SWspan *span)
+{
+   if (span->end > SPAN_CHUNK_SIZE &&
+       span->arrayMask == 0x0 &&
+       span->arrayAttribs == 0x0) {
+      SWspan chunk;
+      GLuint i;
+
+      for (i = 0; i < span->end; i += SPAN_CHUNK_SIZE) {
+         chunk = *span;
+         if (i > 0)
+            advance_span_interpolants(ctx, &chunk, i);
+         chunk.end = MIN2(span->end - i, SPAN_CHUNK_SIZE);
+         write_rgba_span(ctx, &chunk);
+      }
+   }
+   else {
+      write_rgba_span(ctx, span);
+   }
+}
+
+
 /**
  * Read RGBA pixels from a renderbuffer.  Clipping will be done to prevent
  * reading ouside the buffer's boundaries.
@@ -1720,7 +2165,9 @@ _swrast_get_row(GLcontext *ctx, struct gl_renderbuffer *rb,
  * the span's specular color arrays.  The specular color arrays should no
  * longer be needed by time this function is called.
  * Used by blending, logicop and masking functions.
- * \return pointer to the colors we read.
+ * If the renderbuffer is directly addressable, a horizontal span's colors
+ * aren't copied; the returned pointer points into the renderbuffer.
+ * \return pointer to the colors we read (not to be modified).
  */
 void *
 _swrast_get_dest_rgba(GLcontext *ctx, struct gl_renderbuffer *rb,
@@ -1728,6 +2175,17 @@ _swrast_get_dest_rgba(GLcontext *ctx, struct gl_renderbuffer *rb,
 {
    const GLuint pixelSize = RGBA_PIXEL_SIZE(span->array->ChanType);
    void *rbPixels;
+   GLubyte *base;
+   GLint rowStride;
+
+   ASSERT(rb->DataType == span->array->ChanType);
+
+   base = direct_color_address(ctx, rb, &rowStride);
+   if (base && !(span->arrayMask & SPAN_XY) &&
+       span->x >= 0 && span->x + (GLint) span->end <= (GLint) rb->Width &&
+       span->y >= 0 && span->y < (GLint) rb->Height) {
+      return base + span->y * rowStride + span->x * pixelSize;
+   }
 
    /*
     * Point rbPixels to a temporary space (use specular color arrays).
@@ -1735,7 +2193,22 @@ _swrast_get_dest_rgba(GLcontext *ctx, struct gl_renderbuffer *rb,
    rbPixels = span->array->attribs[FRAG_ATTRIB_COL1];
 
    /* Get destination values from renderbuffer */
-   if (span->arrayMask & SPAN_XY) {
+   if (base && (span->arrayMask & SPAN_XY)) {
+      const GLuint words = pixelSize / sizeof(GLuint);
+      const GLint *x = span->array->x, *y = span->array->y;
+      GLuint *dst = (GLuint *) rbPixels;
+      GLuint i, k;
+      for (i = 0; i < span->end; i++) {
+         if (x[i] >= 0 && y[i] >= 0 &&
+             x[i] < (GLint) rb->Width && y[i] < (GLint) rb->Height) {
+            const GLuint *src = (const GLuint *)
+               (base + y[i] * rowStride + x[i] * pixelSize);
+            for (k = 0; k < words; k++)
+               dst[i * words + k] = src[k];
+         }
+      }
+   }
+   else if (span->arrayMask & SPAN_XY) {
       _swrast_get_values(ctx, rb, span->end, span->array->x, span->array->y,
                          rbPixels, pixelSize);
    }
@@ -83,6 +83,14 @@ typedef struct sw_span_arrays
    GLfloat lambda[MAX_TEXTURE_COORD_UNITS][MAX_WIDTH]; /**< Texture LOD */
    GLfloat coverage[MAX_WIDTH];  /**< Fragment coverage for AA/smoothing */
    /*@}*/
+
+   /** Perspective divisor scratch for 1/w and texture 1/q (see s_span.c) */
+   /*@{*/
+   GLfloat invW[MAX_WIDTH + 1];
+   GLfloat invQ[MAX_WIDTH + 1];
+   GLubyte subspanW[MAX_WIDTH];
+   GLubyte subspanQ[MAX_WIDTH];
+   /*@}*/
 } SWspanarrays;
 
 
@@ -182,6 +190,11 @@ _swrast_compute_lambda(GLfloat dsdx, GLfloat dsdy, GLfloat dtdx, GLfloat dtdy,
                        GLfloat dqdx, GLfloat dqdy, GLfloat texW, GLfloat texH,
                        GLfloat s, GLfloat t, GLfloat q, GLfloat invQ);
 
+extern GLfloat
+_swrast_compute_lambda_deriv(GLfloat dsdx, GLfloat dsdy,
+                             GLfloat dtdx, GLfloat dtdy,
+                             GLfloat texW, GLfloat texH);
+
 extern void
 _swrast_write_index_span( GLcontext *ctx, SWspan *span);
 
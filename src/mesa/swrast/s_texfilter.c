@@ -27,6 +27,7 @@
 #include "main/context.h"
 #include "main/colormac.h"
 #include "main/imports.h"
+#include "main/texcompress.h"
 #include "main/texformat.h"
 
 #include "s_context.h"
@@ -910,6 +911,98 @@ sample_lambda_1d( GLcontext *ctx,
 }
 
 
+/**********************************************************************/
+/*                 Compressed texture tile cache                      */
+/**********************************************************************/
+
+
+/**
+ * Invalidate all cached compressed texture tiles.  Called when texture
+ * state (and possibly texture images) changed.
+ */
+void
+_swrast_flush_texel_block_cache(GLcontext *ctx)
+{
+   struct swrast_texel_block_cache *cache
+      = SWRAST_CONTEXT(ctx)->TexelBlockCache;
+   if (cache) {
+      GLuint i;
+      for (i = 0; i < TEXEL_BLOCK_CACHE_SIZE; i++)
+         cache->Block[i].Image = NULL;
+   }
+}
+
+
+/**
+ * Fetch texel (i, j) of a compressed 2D image through the decoded tile
+ * cache.  On a miss, the whole tile is decoded at once.
+ */
+static void
+fetch_compressed_texel(GLcontext *ctx, const struct gl_texture_image *img,
+                       GLint i, GLint j, GLchan rgba[4])
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct swrast_texel_block_cache *cache = swrast->TexelBlockCache;
+   struct swrast_texel_block *block;
+   GLint col, row, x, y;
+
+   if (!cache) {
+      cache = swrast->TexelBlockCache
+         = CALLOC_STRUCT(swrast_texel_block_cache);
+      if (!cache) {
+         img->FetchTexelc(img, i, j, 0, rgba);
+         return;
+      }
+   }
+
+   /* FXT1 tiles are 8x4 texels, S3TC tiles are 4x4 */
+   if (img->TexFormat->MesaFormat == MESA_FORMAT_RGB_FXT1 ||
+       img->TexFormat->MesaFormat == MESA_FORMAT_RGBA_FXT1) {
+      col = i >> 3;
+      x = i & 7;
+      y = (j & 3) << 3;
+   }
+   else {
+      col = i >> 2;
+      x = i & 3;
+      y = (j & 3) << 2;
+   }
+   row = j >> 2;
+
+   /* spans are horizontal, so favor a wide window of tiles */
+   block = &cache->Block[(row * 64 + col) & (TEXEL_BLOCK_CACHE_SIZE - 1)];
+   if (block->Image == img && block->Stamp == img->Stamp &&
+       block->Col == col && block->Row == row) {
+      cache->Hits++;
+   }
+   else {
+      cache->Misses++;
+      _mesa_decompress_block(img, i, j, block->Texels);
+      block->Image = img;
+      block->Stamp = img->Stamp;
+      block->Col = col;
+      block->Row = row;
+   }
+
+   COPY_CHAN4(rgba, block->Texels[y + x]);
+}
+
+
+/**
+ * Fetch a texel from a 2D texture image.
+ */
+static INLINE void
+fetch_texel_2d(GLcontext *ctx, const struct gl_texture_image *img,
+               GLint i, GLint j, GLchan rgba[4])
+{
+   if (img->IsCompressed)
+      fetch_compressed_texel(ctx, img, i, j, rgba);
+   else
+      img->FetchTexelc(img, i, j, 0, rgba);
+}
+
+
+
 /**********************************************************************/
 /*                    2-D Texture Sampling Functions                  */
 /**********************************************************************/
@@ -928,7 +1021,6 @@ sample_2d_nearest(GLcontext *ctx,
    const GLint width = img->Width2;    /* without border, power of two */
    const GLint height = img->Height2;  /* without border, power of two */
    GLint i, j;
-   (void) ctx;
 
    COMPUTE_NEAREST_TEXEL_LOCATION(tObj->WrapS, texcoord[0], width,  i);
    COMPUTE_NEAREST_TEXEL_LOCATION(tObj->WrapT, texcoord[1], height, j);
@@ -942,7 +1034,7 @@ sample_2d_nearest(GLcontext *ctx,
       COPY_CHAN4(rgba, tObj->_BorderChan);
    }
    else {
-      img->FetchTexelc(img, i, j, 0, rgba);
+      fetch_texel_2d(ctx, img, i, j, rgba);
    }
 }
 
@@ -988,25 +1080,25 @@ sample_2d_linear(GLcontext *ctx,
       COPY_CHAN4(t00, tObj->_BorderChan);
    }
    else {
-      img->FetchTexelc(img, i0, j0, 0, t00);
+      fetch_texel_2d(ctx, img, i0, j0, t00);
    }
    if (useBorderColor & (I1BIT | J0BIT)) {
       COPY_CHAN4(t10, tObj->_BorderChan);
    }
    else {
-      img->FetchTexelc(img, i1, j0, 0, t10);
+      fetch_texel_2d(ctx, img, i1, j0, t10);
    }
    if (useBorderColor & (I0BIT | J1BIT)) {
       COPY_CHAN4(t01, tObj->_BorderChan);
    }
    else {
-      img->FetchTexelc(img, i0, j1, 0, t01);
+      fetch_texel_2d(ctx, img, i0, j1, t01);
    }
    if (useBorderColor & (I1BIT | J1BIT)) {
       COPY_CHAN4(t11, tObj->_BorderChan);
    }
    else {
-      img->FetchTexelc(img, i1, j1, 0, t11);
+      fetch_texel_2d(ctx, img, i1, j1, t11);
    }
 
    a = FRAC(u);
@@ -1033,8 +1125,6 @@ sample_2d_linear_repeat(GLcontext *ctx,
    GLfloat a, b;
    GLchan t00[4], t10[4], t01[4], t11[4]; /* sampled texel colors */
 
-   (void) ctx;
-
    ASSERT(tObj->WrapS == GL_REPEAT);
    ASSERT(tObj->WrapT == GL_REPEAT);
    ASSERT(img->Border == 0);
@@ -1044,10 +1134,10 @@ sample_2d_linear_repeat(GLcontext *ctx,
    COMPUTE_LINEAR_REPEAT_TEXEL_LOCATION(texcoord[0], u, width,  i0, i1);
    COMPUTE_LINEAR_REPEAT_TEXEL_LOCATION(texcoord[1], v, height, j0, j1);
 
-   img->FetchTexelc(img, i0, j0, 0, t00);
-   img->FetchTexelc(img, i1, j0, 0, t10);
-   img->FetchTexelc(img, i0, j1, 0, t01);
-   img->FetchTexelc(img, i1, j1, 0, t11);
+   fetch_texel_2d(ctx, img, i0, j0, t00);
+   fetch_texel_2d(ctx, img, i1, j0, t10);
+   fetch_texel_2d(ctx, img, i0, j1, t01);
+   fetch_texel_2d(ctx, img, i1, j1, t11);
 
    a = FRAC(u);
    b = FRAC(v);
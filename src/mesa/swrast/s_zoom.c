@@ -26,6 +26,7 @@
 #include "main/macros.h"
 #include "main/imports.h"
 #include "main/colormac.h"
+#include "main/image.h"
 
 #include "s_context.h"
 #include "s_span.h"
@@ -122,6 +123,175 @@ unzoom_x(GLfloat zoomX, GLint imageX, GLint zx)
 
 
 
+/**
+ * Replicate each source pixel 'factor' times to make n dest pixels, the
+ * first one 'phase' times fewer.  Pixels are 'words' GLuints in size.
+ */
+static void
+replicate_pixels(const GLuint *src, GLuint *dst, GLint n, GLint words,
+                 GLint factor, GLint phase)
+{
+   GLint i = 0;
+
+   if (words == 1) {
+      while (i < n) {
+         const GLuint p = *src++;
+         const GLint end = MIN2(i + factor - phase, n);
+         for (; i < end; i++)
+            dst[i] = p;
+         phase = 0;
+      }
+   }
+   else {
+      while (i < n) {
+         const GLint end = MIN2(i + factor - phase, n);
+         for (; i < end; i++) {
+            GLint k;
+            for (k = 0; k < words; k++)
+               dst[i * words + k] = src[k];
+         }
+         src += words;
+         phase = 0;
+      }
+   }
+}
+
+
+/**
+ * Zoom a span of RGBA or RGB colors and write it to the color buffer
+ * directly, without going through the span functions.  Only usable when
+ * no per-fragment operations are enabled.  The zoomed row is written
+ * once and copied for the other rows, in place if the renderbuffer is
+ * directly addressable.
+ * \return GL_TRUE if done, GL_FALSE if the general path is needed
+ */
+static GLboolean
+fast_zoom_rgba_span(GLcontext *ctx, GLint imgX, const SWspan *span,
+                    const GLvoid *src, GLenum format,
+                    GLint x0, GLint x1, GLint y0, GLint y1)
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct gl_renderbuffer *rb = ctx->DrawBuffer->_ColorDrawBuffers[0];
+   const GLenum srcType = span->array->ChanType;
+   const GLfloat zoomX = ctx->Pixel.ZoomX;
+   const GLint zoomedWidth = x1 - x0;
+   GLuint rgba[MAX_WIDTH][4];
+   GLint words, pixelSize, y;
+   GLvoid *dst, *row;
+
+   if ((swrast->_RasterMask & ~CLIP_BIT) ||
+       ctx->Texture._EnabledCoordUnits ||
+       ctx->Fog.ColorSumEnabled ||
+       (ctx->Light.Enabled &&
+        ctx->Light.Model.ColorControl == GL_SEPARATE_SPECULAR_COLOR) ||
+       !rb) {
+      return GL_FALSE;
+   }
+
+   switch (rb->DataType) {
+   case GL_UNSIGNED_BYTE:
+      words = 1;
+      row = swrast->ZoomedArrays->rgba8;
+      break;
+   case GL_UNSIGNED_SHORT:
+      words = 2;
+      row = swrast->ZoomedArrays->rgba16;
+      break;
+   case GL_FLOAT:
+      if (ctx->Color.ClampFragmentColor == GL_TRUE)
+         return GL_FALSE;
+      words = 4;
+      row = swrast->ZoomedArrays->attribs[FRAG_ATTRIB_COL0];
+      break;
+   default:
+      return GL_FALSE;
+   }
+   pixelSize = words * sizeof(GLuint);
+
+   /* get the unzoomed span as RGBA in the renderbuffer's type */
+   if (format == GL_RGB) {
+      GLint i;
+      if (srcType == GL_UNSIGNED_BYTE) {
+         const GLubyte (*rgb)[3] = (const GLubyte (*)[3]) src;
+         GLubyte (*dstRgba)[4] = (GLubyte (*)[4]) rgba;
+         for (i = 0; i < (GLint) span->end; i++) {
+            dstRgba[i][0] = rgb[i][0];
+            dstRgba[i][1] = rgb[i][1];
+            dstRgba[i][2] = rgb[i][2];
+            dstRgba[i][3] = 0xff;
+         }
+      }
+      else if (srcType == GL_UNSIGNED_SHORT) {
+         const GLushort (*rgb)[3] = (const GLushort (*)[3]) src;
+         GLushort (*dstRgba)[4] = (GLushort (*)[4]) rgba;
+         for (i = 0; i < (GLint) span->end; i++) {
+            dstRgba[i][0] = rgb[i][0];
+            dstRgba[i][1] = rgb[i][1];
+            dstRgba[i][2] = rgb[i][2];
+            dstRgba[i][3] = 0xffff;
+         }
+      }
+      else {
+         const GLfloat (*rgb)[3] = (const GLfloat (*)[3]) src;
+         GLfloat (*dstRgba)[4] = (GLfloat (*)[4]) rgba;
+         for (i = 0; i < (GLint) span->end; i++) {
+            dstRgba[i][0] = rgb[i][0];
+            dstRgba[i][1] = rgb[i][1];
+            dstRgba[i][2] = rgb[i][2];
+            dstRgba[i][3] = 1.0F;
+         }
+      }
+      src = rgba;
+   }
+   if (srcType != rb->DataType) {
+      _mesa_convert_colors(srcType, src, rb->DataType, rgba, span->end, NULL);
+      src = rgba;
+   }
+
+   if (rb->GetPointer(ctx, rb, 0, 0))
+      dst = rb->GetPointer(ctx, rb, x0, y0);
+   else
+      dst = row;
+
+   /* zoom the span horizontally */
+   if (zoomX >= 1.0F && zoomX == (GLfloat) (GLint) zoomX) {
+      const GLint factor = (GLint) zoomX;
+      const GLint first = (x0 - imgX) / factor + imgX - span->x;
+      ASSERT(first >= 0);
+      ASSERT(first < (GLint) span->end);
+      replicate_pixels((const GLuint *) src + first * words, (GLuint *) dst,
+                       zoomedWidth, words, factor, (x0 - imgX) % factor);
+   }
+   else {
+      const GLuint *srcPixels = (const GLuint *) src;
+      GLuint *dstPixels = (GLuint *) dst;
+      GLint i, k;
+      for (i = 0; i < zoomedWidth; i++) {
+         GLint j = unzoom_x(zoomX, imgX, x0 + i) - span->x;
+         ASSERT(j >= 0);
+         ASSERT(j < (GLint) span->end);
+         for (k = 0; k < words; k++)
+            dstPixels[i * words + k] = srcPixels[j * words + k];
+      }
+   }
+
+   /* write the rows [y0, y1) */
+   if (dst != row) {
+      for (y = y0 + 1; y < y1; y++) {
+         _mesa_memcpy(rb->GetPointer(ctx, rb, x0, y), dst,
+                      zoomedWidth * pixelSize);
+      }
+   }
+   else {
+      for (y = y0; y < y1; y++) {
+         rb->PutRow(ctx, rb, zoomedWidth, x0, y, row, NULL);
+      }
+   }
+
+   return GL_TRUE;
+}
+
+
 /**
  * Helper function called from _swrast_write_zoomed_rgba/rgb/
  * index/depth_span().
@@ -151,6 +321,11 @@ zoom_span( GLcontext *ctx, GLint imgX, GLint imgY, const SWspan *span,
    ASSERT(zoomedWidth > 0);
    ASSERT(zoomedWidth <= MAX_WIDTH);
 
+   if ((format == GL_RGBA || format == GL_RGB) &&
+       fast_zoom_rgba_span(ctx, imgX, span, src, format, x0, x1, y0, y1)) {
+      return;
+   }
+
    /* no pixel arrays! must be horizontal spans. */
    ASSERT((span->arrayMask & SPAN_XY) == 0);
    ASSERT(span->primitive == GL_BITMAP);
@@ -88,6 +88,10 @@ _tnl_DestroyContext( GLcontext *ctx )
    TNLcontext *tnl = TNL_CONTEXT(ctx);
 
    _tnl_destroy_pipeline( ctx );
+   _tnl_free_array_cache( ctx );
+
+   if (tnl->select_win.data)
+      _mesa_vector4f_free( &tnl->select_win );
 
    FREE(tnl);
    ctx->swtnl_context = NULL;
@@ -350,6 +350,29 @@ struct tnl_clipspace_fastpath {
    struct tnl_clipspace_fastpath *next;
 };
 
+#define TNL_MAX_ARRAY_CACHE (2 * VERT_ATTRIB_MAX)
+#define TNL_MAX_ARRAY_CACHE_FLOATS (1024 * 1024)  /**< per entry */
+
+/**
+ * A range of a non-float vertex array in a static buffer object,
+ * converted to floats by t_draw.c.  Kept across draws so that the
+ * elements are only converted once; the entry is stale as soon as the
+ * buffer's Stamp moves on.
+ */
+struct tnl_array_cache {
+   struct gl_buffer_object *BufferObj;	/**< referenced */
+   GLuint Stamp;
+   GLuint Offset;			/**< of the first element, < StrideB */
+   GLenum Type;
+   GLint Size;
+   GLsizei StrideB;
+   GLboolean Normalized;
+   GLuint First;			/**< first converted element */
+   GLuint Count;			/**< number of converted elements */
+   GLfloat *Data;
+   GLuint LastUsed;
+};
+
 /**
  * Used to describe conversion of vertex arrays to vertex structures.
  * I.e. Structure of arrays to arrays of structs.
@@ -536,6 +559,15 @@ typedef struct
    GLubyte *block[VERT_ATTRIB_MAX];
    GLuint nr_blocks;
 
+   /* Converted buffer object arrays, also for t_draw.c:
+    */
+   struct tnl_array_cache array_cache[TNL_MAX_ARRAY_CACHE];
+   GLuint array_cache_clock;
+
+   /* Window coordinates for the GL_SELECT path in t_vb_render.c:
+    */
+   GLvector4f select_win;
+
 } TNLcontext;
 
 
@@ -547,4 +579,8 @@ typedef struct
 #define MAX_TYPES TYPE_IDX(GL_DOUBLE)+1      /* 0xa + 1 */
 
 
+extern void
+_tnl_free_array_cache( GLcontext *ctx );
+
+
 #endif
@@ -26,12 +26,14 @@
  */
 
 #include "main/glheader.h"
+#include "main/bufferobj.h"
 #include "main/context.h"
 #include "main/imports.h"
 #include "main/state.h"
 #include "main/mtypes.h"
 #include "main/macros.h"
 #include "main/enums.h"
+#include "main/image.h"
 
 #include "t_context.h"
 #include "t_pipeline.h"
@@ -89,6 +91,195 @@ static void free_space(GLcontext *ctx)
 
 
 
+static void convert_array( GLfloat *fptr,
+			   GLuint count,
+			   const struct gl_client_array *input,
+			   const GLubyte *ptr )
+{
+   const GLuint sz = input->Size;
+
+   switch (input->Type) {
+   case GL_BYTE: 
+      CONVERT(GLbyte, BYTE_TO_FLOAT); 
+      break;
+   case GL_UNSIGNED_BYTE: 
+      CONVERT(GLubyte, UBYTE_TO_FLOAT); 
+      break;
+   case GL_SHORT: 
+      CONVERT(GLshort, SHORT_TO_FLOAT); 
+      break;
+   case GL_UNSIGNED_SHORT: 
+      CONVERT(GLushort, USHORT_TO_FLOAT); 
+      break;
+   case GL_INT: 
+      CONVERT(GLint, INT_TO_FLOAT); 
+      break;
+   case GL_UNSIGNED_INT: 
+      CONVERT(GLuint, UINT_TO_FLOAT); 
+      break;
+   case GL_DOUBLE: 
+      CONVERT(GLdouble, (GLfloat)); 
+      break;
+   default:
+      assert(0);
+      break;
+   }
+}
+
+
+static void release_cached_array( GLcontext *ctx,
+				  struct tnl_array_cache *entry )
+{
+   if (entry->Data) {
+      _mesa_free(entry->Data);
+      entry->Data = NULL;
+   }
+   _mesa_reference_buffer_object(ctx, &entry->BufferObj, NULL);
+}
+
+
+/* Convert elements [first, end) of a buffer object array into the
+ * entry's Data, which holds the entry's elements from entry->First on.
+ */
+static void convert_cached_range( struct tnl_array_cache *entry,
+				  const struct gl_client_array *input,
+				  GLuint first, GLuint end )
+{
+   if (end > first)
+      convert_array(entry->Data + (first - entry->First) * input->Size,
+		    end - first, input,
+		    (const GLubyte *) input->BufferObj->Pointer + entry->Offset
+		    + first * input->StrideB);
+}
+
+
+/* Return the converted contents of a non-float array in a static buffer
+ * object, converting the elements only if the buffer has changed since
+ * the last draw that used them.  Only the elements the draw references
+ * are converted.  An entry which already covers part of the array grows
+ * to the union of both ranges, up to TNL_MAX_ARRAY_CACHE_FLOATS, so
+ * draws which are rebased to different starting vertices share it;
+ * growing keeps the elements converted so far.
+ *
+ * This is only done for buffers in ordinary memory which are mapped
+ * with the fallback functions in bufferobj.c, as those keep
+ * BufferObj->Stamp up to date; a driver is free to write to its own
+ * buffers behind our back.
+ *
+ * The cache has room for twice as many arrays as one draw can use, so
+ * the least recently used entry is never one bound by the current draw.
+ */
+static const GLfloat *lookup_cached_array( GLcontext *ctx,
+					   GLuint count,
+					   const struct gl_client_array *input )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   struct gl_buffer_object *obj = input->BufferObj;
+   const GLuint offset = (GLuint) (uintptr_t) input->Ptr;
+   const GLuint phase = offset % input->StrideB;
+   const GLuint start = offset / input->StrideB;
+   const GLuint elem = input->Size * _mesa_sizeof_type(input->Type);
+   struct tnl_array_cache *victim = NULL;
+   GLuint total, i;
+
+   if (obj->Size < (GLsizeiptrARB) (phase + elem))
+      return NULL;
+
+   total = (obj->Size - phase - elem) / input->StrideB + 1;
+   if (start + count > total ||
+       count * input->Size > TNL_MAX_ARRAY_CACHE_FLOATS)
+      return NULL;
+
+   for (i = 0; i < TNL_MAX_ARRAY_CACHE; i++) {
+      struct tnl_array_cache *entry = &tnl->array_cache[i];
+
+      if (entry->BufferObj == obj &&
+	  entry->Offset == phase &&
+	  entry->Type == input->Type &&
+	  entry->Size == input->Size &&
+	  entry->StrideB == input->StrideB &&
+	  entry->Normalized == input->Normalized) {
+	 if (entry->Stamp == obj->Stamp) {
+	    const GLuint oldEnd = entry->First + entry->Count;
+	    const GLuint first = MIN2(start, entry->First);
+	    const GLuint end = MAX2(start + count, oldEnd);
+
+	    if (first < entry->First || end > oldEnd) {
+	       GLfloat *oldData = entry->Data;
+	       const GLuint oldFirst = entry->First;
+
+	       if ((end - first) * input->Size > TNL_MAX_ARRAY_CACHE_FLOATS)
+		  goto replace;
+
+	       entry->Data = (GLfloat *) _mesa_malloc((end - first) *
+						      input->Size *
+						      sizeof(GLfloat));
+	       if (!entry->Data) {
+		  entry->Data = oldData;
+		  return NULL;
+	       }
+
+	       /* keep the elements converted so far, convert the rest */
+	       entry->First = first;
+	       entry->Count = end - first;
+	       _mesa_memcpy(entry->Data + (oldFirst - first) * input->Size,
+			    oldData, (oldEnd - oldFirst) * input->Size
+			    * sizeof(GLfloat));
+	       _mesa_free(oldData);
+	       convert_cached_range(entry, input, first, oldFirst);
+	       convert_cached_range(entry, input, oldEnd, end);
+	    }
+
+	    entry->LastUsed = ++tnl->array_cache_clock;
+	    return entry->Data + (start - entry->First) * input->Size;
+	 }
+      replace:
+	 victim = entry;
+	 break;
+      }
+
+      /* Drop buffers which only the cache still holds a reference to.
+       */
+      if (entry->BufferObj && entry->BufferObj->RefCount == 1)
+	 release_cached_array(ctx, entry);
+
+      if (!victim || !entry->BufferObj ||
+	  (victim->BufferObj && entry->LastUsed < victim->LastUsed))
+	 victim = entry;
+   }
+
+   release_cached_array(ctx, victim);
+
+   victim->Data = (GLfloat *) _mesa_malloc(count * input->Size *
+					    sizeof(GLfloat));
+   if (!victim->Data)
+      return NULL;
+
+   _mesa_reference_buffer_object(ctx, &victim->BufferObj, obj);
+   victim->Stamp = obj->Stamp;
+   victim->Offset = phase;
+   victim->Type = input->Type;
+   victim->Size = input->Size;
+   victim->StrideB = input->StrideB;
+   victim->Normalized = input->Normalized;
+   victim->First = start;
+   victim->Count = count;
+   victim->LastUsed = ++tnl->array_cache_clock;
+   convert_cached_range(victim, input, start, start + count);
+   return victim->Data;
+}
+
+
+void _tnl_free_array_cache( GLcontext *ctx )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   GLuint i;
+
+   for (i = 0; i < TNL_MAX_ARRAY_CACHE; i++)
+      release_cached_array(ctx, &tnl->array_cache[i]);
+}
+
+
 /* Adjust pointer to point at first requested element, convert to
  * floating point, populate VB->AttribPtr[].
  */
@@ -104,37 +295,21 @@ static void _tnl_import_array( GLcontext *ctx,
 
    if (input->Type != GL_FLOAT) {
       const GLuint sz = input->Size;
-      GLubyte *buf = get_space(ctx, count * sz * sizeof(GLfloat));
-      GLfloat *fptr = (GLfloat *)buf;
-
-      switch (input->Type) {
-      case GL_BYTE: 
-	 CONVERT(GLbyte, BYTE_TO_FLOAT); 
-	 break;
-      case GL_UNSIGNED_BYTE: 
-	 CONVERT(GLubyte, UBYTE_TO_FLOAT); 
-	 break;
-      case GL_SHORT: 
-	 CONVERT(GLshort, SHORT_TO_FLOAT); 
-	 break;
-      case GL_UNSIGNED_SHORT: 
-	 CONVERT(GLushort, USHORT_TO_FLOAT); 
-	 break;
-      case GL_INT: 
-	 CONVERT(GLint, INT_TO_FLOAT); 
-	 break;
-      case GL_UNSIGNED_INT: 
-	 CONVERT(GLuint, UINT_TO_FLOAT); 
-	 break;
-      case GL_DOUBLE: 
-	 CONVERT(GLdouble, (GLfloat)); 
-	 break;
-      default:
-	 assert(0);
-	 break;
+      const GLfloat *fptr = NULL;
+
+      if (input->BufferObj->Name &&
+	  input->BufferObj->Usage == GL_STATIC_DRAW_ARB &&
+	  input->StrideB > 0 &&
+	  ctx->Driver.MapBuffer == _mesa_buffer_map)
+	 fptr = lookup_cached_array(ctx, count, input);
+
+      if (!fptr) {
+	 GLfloat *buf = (GLfloat *) get_space(ctx, count * sz * sizeof(GLfloat));
+	 convert_array(buf, count, input, ptr);
+	 fptr = buf;
       }
 
-      ptr = buf;
+      ptr = (const GLubyte *) fptr;
       stride = sz * sizeof(GLfloat);
    }
 
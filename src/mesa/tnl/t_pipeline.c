@@ -197,6 +197,7 @@ void _tnl_run_pipeline( GLcontext *ctx )
  */
 const struct tnl_pipeline_stage *_tnl_default_pipeline[] = {
    &_tnl_vertex_transform_stage,
+   &_tnl_select_stage,
    &_tnl_normal_transform_stage,
    &_tnl_lighting_stage,
    &_tnl_texgen_stage,
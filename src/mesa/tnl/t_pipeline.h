@@ -53,6 +53,7 @@ extern const struct tnl_pipeline_stage _tnl_texture_transform_stage;
 extern const struct tnl_pipeline_stage _tnl_point_attenuation_stage;
 extern const struct tnl_pipeline_stage _tnl_vertex_program_stage;
 extern const struct tnl_pipeline_stage _tnl_render_stage;
+extern const struct tnl_pipeline_stage _tnl_select_stage;
 
 /* Shorthand to plug in the default pipeline:
  */
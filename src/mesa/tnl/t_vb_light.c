@@ -41,6 +41,12 @@
 #define LIGHT_MATERIAL      0x2
 #define MAX_LIGHT_FUNC      0x4
 
+/* Number of vertices lit per iteration by the structure-of-arrays
+ * functions in t_vb_lighttmp.h.  Smaller blocks get completely unrolled
+ * by the compiler into scalar code instead of being vectorized.
+ */
+#define LIGHT_SOA_SIZE      16
+
 typedef void (*light_func)( GLcontext *ctx,
 			    struct vertex_buffer *VB,
 			    struct tnl_pipeline_stage *stage,
@@ -155,6 +161,94 @@ prepare_materials(GLcontext *ctx,
    return store->mat_count;
 }
 
+/**
+ * Load x, y and z of up to LIGHT_SOA_SIZE vectors into separate arrays,
+ * zero-filling the unused slots of a partial block.
+ */
+static void
+soa_load_3f( GLfloat x[], GLfloat y[], GLfloat z[],
+             const GLfloat *src, GLuint stride, GLuint n )
+{
+   GLuint k;
+
+   for (k = 0; k < n; k++, STRIDE_F(src, stride)) {
+      x[k] = src[0];
+      y[k] = src[1];
+      z[k] = src[2];
+   }
+   for ( ; k < LIGHT_SOA_SIZE; k++)
+      x[k] = y[k] = z[k] = 0.0F;
+}
+
+
+/**
+ * Normalize a block of vectors in place, leaving zero-length ones alone.
+ */
+static void
+soa_normalize_3f( GLfloat x[], GLfloat y[], GLfloat z[] )
+{
+   GLuint k;
+
+   for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+      const GLfloat len = x[k] * x[k] + y[k] * y[k] + z[k] * z[k];
+      const GLfloat inv = len ? INV_SQRTF(len) : 1.0F;
+      x[k] *= inv;
+      y[k] *= inv;
+      z[k] *= inv;
+   }
+}
+
+
+/**
+ * Specular coefficient for a block of n dot h values.  Zero for slots
+ * where n dot h isn't positive.  The table lookup doesn't vectorize, so
+ * this is the one per-vertex loop left in the SoA lighting functions.
+ */
+static void
+soa_shine( struct gl_shine_tab *tab, const GLfloat n_dot_h[],
+           GLfloat coef[] )
+{
+   GLuint i;   /* not k, GET_SHINE_TAB_ENTRY declares its own */
+
+   for (i = 0; i < LIGHT_SOA_SIZE; i++) {
+      if (n_dot_h[i] > 0.0F)
+         GET_SHINE_TAB_ENTRY( tab, n_dot_h[i], coef[i] );
+      else
+         coef[i] = 0.0F;
+   }
+}
+
+
+/**
+ * Scale a block of attenuation factors by the spotlight falloff.
+ * VP is the unit vector from each vertex to the light.
+ */
+static void
+soa_spot_attenuation( const struct gl_light *light,
+                      const GLfloat VPx[], const GLfloat VPy[],
+                      const GLfloat VPz[], GLfloat attenuation[] )
+{
+   GLuint k;
+
+   for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+      const GLfloat PV_dot_dir = -(VPx[k] * light->_NormDirection[0] +
+                                   VPy[k] * light->_NormDirection[1] +
+                                   VPz[k] * light->_NormDirection[2]);
+
+      if (PV_dot_dir < light->_CosCutoff) {
+         attenuation[k] = 0.0F;
+      }
+      else {
+         GLdouble x = PV_dot_dir * (EXP_TABLE_SIZE-1);
+         GLint i = (GLint) x;
+         GLfloat spot = (GLfloat) (light->_SpotExpTable[i][0]
+                                   + (x-i)*light->_SpotExpTable[i][1]);
+         attenuation[k] *= spot;
+      }
+   }
+}
+
+
 /* Tables for all the shading functions.
  */
 static light_func _tnl_light_tab[MAX_LIGHT_FUNC];
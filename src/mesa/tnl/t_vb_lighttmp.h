@@ -38,6 +38,8 @@
 /* define TRACE to trace lighting code */
 /* #define TRACE 1 */
 
+#if IDX & LIGHT_MATERIAL
+
 /*
  * ctx is the current context
  * VB is the vertex buffer
@@ -419,6 +421,9 @@ static void TAG(light_rgba)( GLcontext *ctx,
 
 
 
+#endif /* IDX & LIGHT_MATERIAL */
+
+
 /* As below, but with just a single light.
  */
 static void TAG(light_fast_rgba_single)( GLcontext *ctx,
@@ -527,6 +532,8 @@ static void TAG(light_fast_rgba_single)( GLcontext *ctx,
 }
 
 
+#if IDX & LIGHT_MATERIAL
+
 /* Light infinite lights
  */
 static void TAG(light_fast_rgba)( GLcontext *ctx,
@@ -638,6 +645,357 @@ static void TAG(light_fast_rgba)( GLcontext *ctx,
 
 
 
+#endif /* IDX & LIGHT_MATERIAL */
+
+
+#if !(IDX & LIGHT_MATERIAL)
+
+/*
+ * Structure-of-arrays versions of light_rgba, light_rgba_spec and
+ * light_fast_rgba for when no material attribute changes per vertex.
+ * Vertices are lit LIGHT_SOA_SIZE at a time.  Each per-vertex quantity
+ * is held as an array with one slot per vertex, so the loops over a
+ * block have no data-dependent branches and the compiler can vectorize
+ * them.  A light that doesn't reach a vertex contributes zero instead
+ * of being skipped.
+ */
+static void TAG(light_rgba_soa)( GLcontext *ctx,
+				 struct vertex_buffer *VB,
+				 struct tnl_pipeline_stage *stage,
+				 GLvector4f *input )
+{
+   struct light_stage_data *store = LIGHT_STAGE_DATA(stage);
+   GLfloat (*base)[3] = ctx->Light._BaseColor;
+   const GLboolean separate =
+      (ctx->Light.Model.ColorControl == GL_SEPARATE_SPECULAR_COLOR);
+   GLfloat sumA[2];
+   GLuint j, k, side;
+
+   const GLuint vstride = input->stride;
+   const GLfloat *vertex = (GLfloat *)input->data;
+   const GLuint nstride = VB->AttribPtr[_TNL_ATTRIB_NORMAL]->stride;
+   const GLfloat *normal = (GLfloat *)VB->AttribPtr[_TNL_ATTRIB_NORMAL]->data;
+
+   GLfloat (*Fcolor)[4] = (GLfloat (*)[4]) store->LitColor[0].data;
+   GLfloat (*Fspec)[4] = (GLfloat (*)[4]) store->LitSecondary[0].data;
+#if IDX & LIGHT_TWOSIDE
+   GLfloat (*Bcolor)[4] = (GLfloat (*)[4]) store->LitColor[1].data;
+   GLfloat (*Bspec)[4] = (GLfloat (*)[4]) store->LitSecondary[1].data;
+#endif
+
+   const GLuint nr = VB->Count;
+
+#ifdef TRACE
+   fprintf(stderr, "%s\n", __FUNCTION__ );
+#endif
+
+   VB->ColorPtr[0] = &store->LitColor[0];
+   sumA[0] = ctx->Light.Material.Attrib[MAT_ATTRIB_FRONT_DIFFUSE][3];
+   if (separate)
+      VB->SecondaryColorPtr[0] = &store->LitSecondary[0];
+
+#if IDX & LIGHT_TWOSIDE
+   VB->ColorPtr[1] = &store->LitColor[1];
+   sumA[1] = ctx->Light.Material.Attrib[MAT_ATTRIB_BACK_DIFFUSE][3];
+   if (separate)
+      VB->SecondaryColorPtr[1] = &store->LitSecondary[1];
+#endif
+
+   store->LitColor[0].stride = 16;
+   store->LitColor[1].stride = 16;
+
+   for (j = 0; j < nr; j += LIGHT_SOA_SIZE) {
+      const GLuint n = MIN2(nr - j, LIGHT_SOA_SIZE);
+      GLfloat vx[LIGHT_SOA_SIZE], vy[LIGHT_SOA_SIZE], vz[LIGHT_SOA_SIZE];
+      GLfloat nx[LIGHT_SOA_SIZE], ny[LIGHT_SOA_SIZE], nz[LIGHT_SOA_SIZE];
+      GLfloat sum[NR_SIDES][3][LIGHT_SOA_SIZE];
+      GLfloat spec[NR_SIDES][3][LIGHT_SOA_SIZE];
+      struct gl_light *light;
+
+      soa_load_3f( vx, vy, vz, vertex, vstride, n );
+      soa_load_3f( nx, ny, nz, normal, nstride, n );
+      STRIDE_F(vertex, n * vstride);
+      STRIDE_F(normal, n * nstride);
+
+      for (side = 0; side < NR_SIDES; side++) {
+	 for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	    sum[side][0][k] = base[side][0];
+	    sum[side][1][k] = base[side][1];
+	    sum[side][2][k] = base[side][2];
+	    spec[side][0][k] = 0.0F;
+	    spec[side][1][k] = 0.0F;
+	    spec[side][2][k] = 0.0F;
+	 }
+      }
+
+      /* Add contribution from each enabled light source */
+      foreach (light, &ctx->Light.EnabledList) {
+	 GLfloat attenuation[LIGHT_SOA_SIZE];
+	 GLfloat VPx[LIGHT_SOA_SIZE], VPy[LIGHT_SOA_SIZE], VPz[LIGHT_SOA_SIZE];
+	 GLfloat n_dot_VP[LIGHT_SOA_SIZE];
+	 GLfloat n_dot_h[LIGHT_SOA_SIZE];
+	 GLfloat dp[LIGHT_SOA_SIZE], coef[LIGHT_SOA_SIZE];
+
+	 /* compute VP and attenuation */
+	 if (!(light->_Flags & LIGHT_POSITIONAL)) {
+	    /* directional light */
+	    if (light->_VP_inf_spot_attenuation < 1e-3)
+	       continue;	/* this light makes no contribution */
+
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       VPx[k] = light->_VP_inf_norm[0];
+	       VPy[k] = light->_VP_inf_norm[1];
+	       VPz[k] = light->_VP_inf_norm[2];
+	       attenuation[k] = light->_VP_inf_spot_attenuation;
+	    }
+	 }
+	 else {
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       GLfloat d, invd;     /* distance from vertex to light */
+
+	       VPx[k] = light->_Position[0] - vx[k];
+	       VPy[k] = light->_Position[1] - vy[k];
+	       VPz[k] = light->_Position[2] - vz[k];
+
+	       d = SQRTF(VPx[k] * VPx[k] + VPy[k] * VPy[k] + VPz[k] * VPz[k]);
+	       invd = d > 1e-6 ? 1.0F / d : 1.0F;
+	       VPx[k] *= invd;
+	       VPy[k] *= invd;
+	       VPz[k] *= invd;
+
+	       attenuation[k] = 1.0F / (light->ConstantAttenuation + d *
+					(light->LinearAttenuation + d *
+					 light->QuadraticAttenuation));
+	    }
+
+	    /* spotlight attenuation */
+	    if (light->_Flags & LIGHT_SPOT)
+	       soa_spot_attenuation( light, VPx, VPy, VPz, attenuation );
+
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       if (attenuation[k] < 1e-3)
+		  attenuation[k] = 0.0F;
+	    }
+	 }
+
+	 /* Compute dot product or normal and vector from V to light pos */
+	 for (k = 0; k < LIGHT_SOA_SIZE; k++)
+	    n_dot_VP[k] = nx[k] * VPx[k] + ny[k] * VPy[k] + nz[k] * VPz[k];
+
+	 /* half-angle vector - cannibalize VP... */
+	 if (ctx->Light.Model.LocalViewer) {
+	    GLfloat ex[LIGHT_SOA_SIZE], ey[LIGHT_SOA_SIZE], ez[LIGHT_SOA_SIZE];
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       ex[k] = vx[k];
+	       ey[k] = vy[k];
+	       ez[k] = vz[k];
+	    }
+	    soa_normalize_3f( ex, ey, ez );
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       VPx[k] -= ex[k];                /* h = VP + VPe */
+	       VPy[k] -= ey[k];
+	       VPz[k] -= ez[k];
+	    }
+	    soa_normalize_3f( VPx, VPy, VPz );
+	 }
+	 else if (light->_Flags & LIGHT_POSITIONAL) {
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       VPx[k] += ctx->_EyeZDir[0];
+	       VPy[k] += ctx->_EyeZDir[1];
+	       VPz[k] += ctx->_EyeZDir[2];
+	    }
+	    soa_normalize_3f( VPx, VPy, VPz );
+	 }
+	 else {
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       VPx[k] = light->_h_inf_norm[0];
+	       VPy[k] = light->_h_inf_norm[1];
+	       VPz[k] = light->_h_inf_norm[2];
+	    }
+	 }
+
+	 for (k = 0; k < LIGHT_SOA_SIZE; k++)
+	    n_dot_h[k] = nx[k] * VPx[k] + ny[k] * VPy[k] + nz[k] * VPz[k];
+
+	 /* Both sides always get the ambient term; the side the normal
+	  * faces also gets the diffuse and specular terms.
+	  */
+	 for (side = 0; side < NR_SIDES; side++) {
+	    const GLfloat *ambient = light->_MatAmbient[side];
+	    const GLfloat *diffuse = light->_MatDiffuse[side];
+	    const GLfloat *specular = light->_MatSpecular[side];
+	    const GLfloat correction = side ? -1.0F : 1.0F;
+
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       const GLfloat nv = correction * n_dot_VP[k];
+	       const GLboolean lit = side ? nv > 0.0F : nv >= 0.0F;
+	       const GLfloat d = lit ? nv : 0.0F;
+	       sum[side][0][k] += attenuation[k] * (ambient[0] + d * diffuse[0]);
+	       sum[side][1][k] += attenuation[k] * (ambient[1] + d * diffuse[1]);
+	       sum[side][2][k] += attenuation[k] * (ambient[2] + d * diffuse[2]);
+	       dp[k] = lit ? correction * n_dot_h[k] : 0.0F;
+	    }
+
+	    soa_shine( ctx->_ShineTable[side], dp, coef );
+
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       const GLfloat s = coef[k] > 1.0e-10 ? coef[k] * attenuation[k] : 0.0F;
+	       spec[side][0][k] += s * specular[0];
+	       spec[side][1][k] += s * specular[1];
+	       spec[side][2][k] += s * specular[2];
+	    }
+	 }
+      } /*loop over lights*/
+
+      if (separate) {
+	 for (k = 0; k < n; k++) {
+	    Fspec[j + k][0] = spec[0][0][k];
+	    Fspec[j + k][1] = spec[0][1][k];
+	    Fspec[j + k][2] = spec[0][2][k];
+#if IDX & LIGHT_TWOSIDE
+	    Bspec[j + k][0] = spec[1][0][k];
+	    Bspec[j + k][1] = spec[1][1][k];
+	    Bspec[j + k][2] = spec[1][2][k];
+#endif
+	 }
+      }
+      else {
+	 for (side = 0; side < NR_SIDES; side++) {
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       sum[side][0][k] += spec[side][0][k];
+	       sum[side][1][k] += spec[side][1][k];
+	       sum[side][2][k] += spec[side][2][k];
+	    }
+	 }
+      }
+
+      for (k = 0; k < n; k++) {
+	 Fcolor[j + k][0] = sum[0][0][k];
+	 Fcolor[j + k][1] = sum[0][1][k];
+	 Fcolor[j + k][2] = sum[0][2][k];
+	 Fcolor[j + k][3] = sumA[0];
+#if IDX & LIGHT_TWOSIDE
+	 Bcolor[j + k][0] = sum[1][0][k];
+	 Bcolor[j + k][1] = sum[1][1][k];
+	 Bcolor[j + k][2] = sum[1][2][k];
+	 Bcolor[j + k][3] = sumA[1];
+#endif
+      }
+   }
+}
+
+
+/* Light infinite lights, LIGHT_SOA_SIZE vertices at a time.
+ */
+static void TAG(light_fast_rgba_soa)( GLcontext *ctx,
+				      struct vertex_buffer *VB,
+				      struct tnl_pipeline_stage *stage,
+				      GLvector4f *input )
+{
+   struct light_stage_data *store = LIGHT_STAGE_DATA(stage);
+   GLfloat sumA[2];
+   const GLuint nstride = VB->AttribPtr[_TNL_ATTRIB_NORMAL]->stride;
+   const GLfloat *normal = (GLfloat *)VB->AttribPtr[_TNL_ATTRIB_NORMAL]->data;
+   GLfloat (*Fcolor)[4] = (GLfloat (*)[4]) store->LitColor[0].data;
+#if IDX & LIGHT_TWOSIDE
+   GLfloat (*Bcolor)[4] = (GLfloat (*)[4]) store->LitColor[1].data;
+#endif
+   const GLuint nr = VB->AttribPtr[_TNL_ATTRIB_NORMAL]->count;
+   GLuint j, k, side;
+
+#ifdef TRACE
+   fprintf(stderr, "%s %d\n", __FUNCTION__, nr );
+#endif
+
+   (void) input;
+
+   sumA[0] = ctx->Light.Material.Attrib[MAT_ATTRIB_FRONT_DIFFUSE][3];
+   sumA[1] = ctx->Light.Material.Attrib[MAT_ATTRIB_BACK_DIFFUSE][3];
+
+   VB->ColorPtr[0] = &store->LitColor[0];
+#if IDX & LIGHT_TWOSIDE
+   VB->ColorPtr[1] = &store->LitColor[1];
+#endif
+
+   if (nr > 1) {
+      store->LitColor[0].stride = 16;
+      store->LitColor[1].stride = 16;
+   }
+   else {
+      store->LitColor[0].stride = 0;
+      store->LitColor[1].stride = 0;
+   }
+
+   for (j = 0; j < nr; j += LIGHT_SOA_SIZE) {
+      const GLuint n = MIN2(nr - j, LIGHT_SOA_SIZE);
+      GLfloat nx[LIGHT_SOA_SIZE], ny[LIGHT_SOA_SIZE], nz[LIGHT_SOA_SIZE];
+      GLfloat sum[NR_SIDES][3][LIGHT_SOA_SIZE];
+      const struct gl_light *light;
+
+      soa_load_3f( nx, ny, nz, normal, nstride, n );
+      STRIDE_F(normal, n * nstride);
+
+      for (side = 0; side < NR_SIDES; side++) {
+	 for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	    sum[side][0][k] = ctx->Light._BaseColor[side][0];
+	    sum[side][1][k] = ctx->Light._BaseColor[side][1];
+	    sum[side][2][k] = ctx->Light._BaseColor[side][2];
+	 }
+      }
+
+      foreach (light, &ctx->Light.EnabledList) {
+	 const GLfloat *VP = light->_VP_inf_norm;
+	 const GLfloat *h = light->_h_inf_norm;
+	 GLfloat n_dot_VP[LIGHT_SOA_SIZE], n_dot_h[LIGHT_SOA_SIZE];
+	 GLfloat dp[LIGHT_SOA_SIZE], spec[LIGHT_SOA_SIZE];
+
+	 for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	    n_dot_VP[k] = nx[k] * VP[0] + ny[k] * VP[1] + nz[k] * VP[2];
+	    n_dot_h[k] = nx[k] * h[0] + ny[k] * h[1] + nz[k] * h[2];
+	 }
+
+	 for (side = 0; side < NR_SIDES; side++) {
+	    const GLfloat *ambient = light->_MatAmbient[side];
+	    const GLfloat *diffuse = light->_MatDiffuse[side];
+	    const GLfloat *specular = light->_MatSpecular[side];
+	    const GLfloat correction = side ? -1.0F : 1.0F;
+
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       const GLboolean lit = side ? n_dot_VP[k] <= 0.0F : n_dot_VP[k] > 0.0F;
+	       dp[k] = lit ? correction * n_dot_h[k] : 0.0F;
+	    }
+
+	    soa_shine( ctx->_ShineTable[side], dp, spec );
+
+	    for (k = 0; k < LIGHT_SOA_SIZE; k++) {
+	       const GLfloat nv = correction * n_dot_VP[k];
+	       const GLfloat d = nv > 0.0F ? nv : 0.0F;
+	       sum[side][0][k] += ambient[0] + d * diffuse[0] + spec[k] * specular[0];
+	       sum[side][1][k] += ambient[1] + d * diffuse[1] + spec[k] * specular[1];
+	       sum[side][2][k] += ambient[2] + d * diffuse[2] + spec[k] * specular[2];
+	    }
+	 }
+      }
+
+      for (k = 0; k < n; k++) {
+	 Fcolor[j + k][0] = sum[0][0][k];
+	 Fcolor[j + k][1] = sum[0][1][k];
+	 Fcolor[j + k][2] = sum[0][2][k];
+	 Fcolor[j + k][3] = sumA[0];
+#if IDX & LIGHT_TWOSIDE
+	 Bcolor[j + k][0] = sum[1][0][k];
+	 Bcolor[j + k][1] = sum[1][1][k];
+	 Bcolor[j + k][2] = sum[1][2][k];
+	 Bcolor[j + k][3] = sumA[1];
+#endif
+      }
+   }
+}
+
+#endif /* !(IDX & LIGHT_MATERIAL) */
+
+
+
 /*
  * Use current lighting/material settings to compute the color indexes
  * for an array of vertices.
@@ -811,10 +1169,16 @@ static void TAG(light_ci)( GLcontext *ctx,
 
 static void TAG(init_light_tab)( void )
 {
+#if IDX & LIGHT_MATERIAL
    _tnl_light_tab[IDX] = TAG(light_rgba);
    _tnl_light_fast_tab[IDX] = TAG(light_fast_rgba);
-   _tnl_light_fast_single_tab[IDX] = TAG(light_fast_rgba_single);
    _tnl_light_spec_tab[IDX] = TAG(light_rgba_spec);
+#else
+   _tnl_light_tab[IDX] = TAG(light_rgba_soa);
+   _tnl_light_fast_tab[IDX] = TAG(light_fast_rgba_soa);
+   _tnl_light_spec_tab[IDX] = TAG(light_rgba_soa);
+#endif
+   _tnl_light_fast_single_tab[IDX] = TAG(light_fast_rgba_single);
    _tnl_light_ci_tab[IDX] = TAG(light_ci);
 }
 
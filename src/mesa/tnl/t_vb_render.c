@@ -44,6 +44,8 @@
 #include "main/macros.h"
 #include "main/imports.h"
 #include "main/mtypes.h"
+#include "main/feedback.h"
+#include "math/m_matrix.h"
 
 #include "t_pipeline.h"
 
@@ -328,6 +330,194 @@ static GLboolean run_render( GLcontext *ctx,
 }
 
 
+/**********************************************************************/
+/*                  Selection without rasterization                   */
+/**********************************************************************/
+
+/* In GL_SELECT mode all that's needed from a primitive is the window
+ * Z of its (clipped) vertices.  The functions below are swapped into
+ * tnl->Driver.Render for the duration of run_render(), so that the
+ * regular clipping code is reused while vertex emission and the
+ * rasterizer are bypassed entirely.  They produce the same hits as
+ * the swrast_setup/swrast select path.
+ */
+
+/* Window coordinates of a vertex, computed as the vertex emit code
+ * would: from the NDC of the original vertices, or by projecting the
+ * clip coordinates of vertices generated by clipping.
+ */
+static INLINE void select_window_pos( GLcontext *ctx, const GLfloat *pos,
+				      GLfloat *win )
+{
+   const GLfloat *m = ctx->Viewport._WindowMap.m;
+
+   win[0] = m[MAT_SX] * pos[0] + m[MAT_TX];
+   win[1] = m[MAT_SY] * pos[1] + m[MAT_TY];
+   win[2] = m[MAT_SZ] * pos[2] + m[MAT_TZ];
+}
+
+static void select_build_vertices( GLcontext *ctx, GLuint start,
+				   GLuint end, GLuint new_inputs )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   const GLvector4f *ndc = tnl->vb.NdcPtr;
+   GLfloat (*win)[4] = tnl->select_win.data;
+   GLuint i;
+   (void) new_inputs;
+
+   for (i = start; i < end; i++)
+      select_window_pos( ctx, VEC_ELT(ndc, GLfloat, i), win[i] );
+}
+
+static void select_interp( GLcontext *ctx, GLfloat t, GLuint dst,
+			   GLuint out, GLuint in, GLboolean force_boundary )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   const GLfloat *clip = tnl->vb.ClipPtr->data[dst];
+   (void) t; (void) out; (void) in; (void) force_boundary;
+
+   if (clip[3] != 0.0) {
+      const GLfloat w = 1.0f / clip[3];
+      GLfloat ndc[3];
+
+      ndc[0] = clip[0] * w;
+      ndc[1] = clip[1] * w;
+      ndc[2] = clip[2] * w;
+      select_window_pos( ctx, ndc, tnl->select_win.data[dst] );
+   }
+}
+
+static INLINE void select_hit( GLcontext *ctx, GLuint idx )
+{
+   const GLfloat zs = 1.0F / ctx->DrawBuffer->_DepthMaxF;
+   _mesa_update_hitflag( ctx, TNL_CONTEXT(ctx)->select_win.data[idx][2] * zs );
+}
+
+static void select_points( GLcontext *ctx, GLuint first, GLuint last )
+{
+   struct vertex_buffer *VB = &TNL_CONTEXT(ctx)->vb;
+   GLuint i;
+
+   for (i = first; i < last; i++) {
+      const GLuint e = VB->Elts ? VB->Elts[i] : i;
+      if (VB->ClipMask[e] == 0)
+	 select_hit( ctx, e );
+   }
+}
+
+static void select_line( GLcontext *ctx, GLuint v0, GLuint v1 )
+{
+   select_hit( ctx, v0 );
+   select_hit( ctx, v1 );
+}
+
+static void select_triangle( GLcontext *ctx, GLuint e0, GLuint e1, GLuint e2 )
+{
+   GLfloat (*win)[4] = TNL_CONTEXT(ctx)->select_win.data;
+   const GLfloat zs = 1.0F / ctx->DrawBuffer->_DepthMaxF;
+
+   /* Same culling as swrast applies to selected triangles.
+    */
+   if (ctx->Polygon.CullFlag) {
+      const GLfloat ex = win[e1][0] - win[e0][0];
+      const GLfloat ey = win[e1][1] - win[e0][1];
+      const GLfloat fx = win[e2][0] - win[e0][0];
+      const GLfloat fy = win[e2][1] - win[e0][1];
+      const GLfloat c = ex*fy - ey*fx;
+
+      switch (ctx->Polygon.CullFaceMode) {
+      case GL_BACK:
+	 if (c < 0.0F)
+	    return;
+	 break;
+      case GL_FRONT:
+	 if (c > 0.0F)
+	    return;
+	 break;
+      default:
+	 return;
+      }
+   }
+
+   _mesa_update_hitflag( ctx, win[e0][2] * zs );
+   _mesa_update_hitflag( ctx, win[e1][2] * zs );
+   _mesa_update_hitflag( ctx, win[e2][2] * zs );
+}
+
+static void select_quad( GLcontext *ctx, GLuint v0, GLuint v1,
+			 GLuint v2, GLuint v3 )
+{
+   select_triangle( ctx, v0, v1, v3 );
+   select_triangle( ctx, v1, v2, v3 );
+}
+
+static void select_noop( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+static void select_primitive_notify( GLcontext *ctx, GLenum mode )
+{
+   (void) ctx;
+   (void) mode;
+}
+
+static void select_copy_pv( GLcontext *ctx, GLuint dst, GLuint src )
+{
+   (void) ctx; (void) dst; (void) src;
+}
+
+/* Only the fixed-function, filled, unoffset case is handled here.
+ * Anything else (vertex programs, glPolygonMode, polygon offset, or
+ * drivers that don't want NDC) goes down the regular path.
+ */
+static GLboolean run_select( GLcontext *ctx,
+			     struct tnl_pipeline_stage *stage )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   struct tnl_device_driver saved;
+
+   if (ctx->RenderMode != GL_SELECT ||
+       ctx->VertexProgram._Current ||
+       !tnl->NeedNdcCoords ||
+       ctx->Polygon.FrontMode != GL_FILL ||
+       ctx->Polygon.BackMode != GL_FILL ||
+       ctx->Polygon.OffsetFill)
+      return GL_TRUE;
+
+   if (!tnl->select_win.data) {
+      _mesa_vector4f_alloc( &tnl->select_win, 0, tnl->vb.Size, 32 );
+      if (!tnl->select_win.data)
+	 return GL_TRUE;
+   }
+
+   saved = tnl->Driver;
+
+   tnl->Driver.Render.Start = select_noop;
+   tnl->Driver.Render.Finish = select_noop;
+   tnl->Driver.Render.PrimitiveNotify = select_primitive_notify;
+   tnl->Driver.Render.Interp = select_interp;
+   tnl->Driver.Render.CopyPV = select_copy_pv;
+   tnl->Driver.Render.ClippedPolygon = _tnl_RenderClippedPolygon;
+   tnl->Driver.Render.ClippedLine = _tnl_RenderClippedLine;
+   tnl->Driver.Render.Points = select_points;
+   tnl->Driver.Render.Line = select_line;
+   tnl->Driver.Render.Triangle = select_triangle;
+   tnl->Driver.Render.Quad = select_quad;
+   tnl->Driver.Render.PrimTabVerts = _tnl_render_tab_verts;
+   tnl->Driver.Render.PrimTabElts = _tnl_render_tab_elts;
+   tnl->Driver.Render.ResetLineStipple = select_noop;
+   tnl->Driver.Render.BuildVertices = select_build_vertices;
+   tnl->Driver.Render.Multipass = NULL;
+
+   run_render( ctx, stage );
+
+   tnl->Driver = saved;
+
+   return GL_FALSE;		/* finished the pipe */
+}
+
+
 /**********************************************************************/
 /*                          Render pipeline stage                     */
 /**********************************************************************/
@@ -345,3 +535,14 @@ const struct tnl_pipeline_stage _tnl_render_stage =
    NULL,			/* validate */
    run_render			/* run */
 };
+
+
+const struct tnl_pipeline_stage _tnl_select_stage =
+{
+   "select",			/* name */
+   NULL,			/* private data */
+   NULL,			/* creator */
+   NULL,			/* destructor */
+   NULL,			/* validate */
+   run_select			/* run */
+};
@@ -32,6 +32,7 @@
 
 #include "main/glheader.h"
 #include "main/ffvertex_prog.h"
+#include "shader/program.h"
 #include "t_vp_build.h"
 
 
@@ -44,9 +45,15 @@ void _tnl_UpdateFixedFunctionProgram( GLcontext *ctx )
 
    if (!ctx->VertexProgram._Current ||
        ctx->VertexProgram._Current == ctx->VertexProgram._TnlProgram) {
-      ctx->VertexProgram._Current
-         = ctx->VertexProgram._TnlProgram
-         = _mesa_get_fixed_func_vertex_program(ctx);
+      struct gl_vertex_program *newProg =
+         _mesa_get_fixed_func_vertex_program(ctx);
+
+      /* Hold references: the shared program cache may evict the
+       * program while this context is still using it.
+       */
+      _mesa_reference_vertprog(ctx, &ctx->VertexProgram._Current, newProg);
+      _mesa_reference_vertprog(ctx, &ctx->VertexProgram._TnlProgram, newProg);
+      _mesa_reference_vertprog(ctx, &newProg, NULL);
    }
 
    /* Tell the driver about the change.  Could define a new target for
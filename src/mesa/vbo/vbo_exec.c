@@ -74,6 +74,7 @@ void vbo_exec_destroy( GLcontext *ctx )
 
    vbo_exec_vtx_destroy( exec );
    vbo_exec_array_destroy( exec );
+   vbo_exec_eval_destroy( exec );
 }
 
 /* Really want to install these callbacks to a central facility to be
@@ -84,8 +85,10 @@ void vbo_exec_invalidate_state( GLcontext *ctx, GLuint new_state )
 {
    struct vbo_exec_context *exec = &vbo_context(ctx)->exec;
 
-   if (new_state & (_NEW_PROGRAM|_NEW_EVAL))
+   if (new_state & (_NEW_PROGRAM|_NEW_EVAL)) {
       exec->eval.recalculate_maps = 1;
+      exec->eval.mesh_valid = GL_FALSE;
+   }
 
    _ae_invalidate_state(ctx, new_state);
 }
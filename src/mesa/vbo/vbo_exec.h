@@ -112,6 +112,17 @@ struct vbo_exec_context
       GLboolean recalculate_maps;
       struct vbo_exec_eval1_map map1[VERT_ATTRIB_MAX];
       struct vbo_exec_eval2_map map2[VERT_ATTRIB_MAX];
+
+      /* Attributes evaluated over the last glEvalMesh2 grid, four
+       * floats per attribute in mesh_attr[] order.  Reused until the
+       * maps, the grid or the mesh bounds change:
+       */
+      GLfloat *mesh;
+      GLuint mesh_size;
+      GLuint mesh_attr[VBO_ATTRIB_TEX7 + 2];
+      GLuint mesh_nr_attr;
+      GLint mesh_i1, mesh_i2, mesh_j1, mesh_j2;
+      GLboolean mesh_valid;
    } eval;
 
    struct {
@@ -162,6 +173,11 @@ void vbo_exec_do_EvalCoord2f( struct vbo_exec_context *exec,
 void vbo_exec_do_EvalCoord1f( struct vbo_exec_context *exec,
 				     GLfloat u);
 
+const GLfloat *vbo_exec_eval_mesh2( struct vbo_exec_context *exec,
+                                    GLint i1, GLint i2, GLint j1, GLint j2 );
+
+void vbo_exec_eval_destroy( struct vbo_exec_context *exec );
+
 extern GLboolean 
 vbo_validate_shaders(GLcontext *ctx);
 
@@ -388,6 +388,24 @@ do {								\
 
 /* Eval
  */
+/* Make room in the vertex for each attribute the 2D maps produce.
+ */
+static void vbo_exec_eval2_fixup_vertex( GLcontext *ctx )
+{
+   struct vbo_exec_context *exec = &vbo_context(ctx)->exec;
+   GLint i;
+
+   for (i = 0; i <= VBO_ATTRIB_TEX7; i++) {
+      if (exec->eval.map2[i].map) 
+	 if (exec->vtx.active_sz[i] != exec->eval.map2[i].sz)
+	    vbo_exec_fixup_vertex( ctx, i, exec->eval.map2[i].sz );
+   }
+
+   if (ctx->Eval.AutoNormal) 
+      if (exec->vtx.active_sz[VBO_ATTRIB_NORMAL] != 3)
+	 vbo_exec_fixup_vertex( ctx, VBO_ATTRIB_NORMAL, 3 );
+}
+
 static void GLAPIENTRY vbo_exec_EvalCoord1f( GLfloat u )
 {
    GET_CURRENT_CONTEXT( ctx );
@@ -420,21 +438,10 @@ static void GLAPIENTRY vbo_exec_EvalCoord2f( GLfloat u, GLfloat v )
    GET_CURRENT_CONTEXT( ctx );
    struct vbo_exec_context *exec = &vbo_context(ctx)->exec;
 
-   {
-      GLint i;
-      if (exec->eval.recalculate_maps) 
-	 vbo_exec_eval_update( exec );
+   if (exec->eval.recalculate_maps) 
+      vbo_exec_eval_update( exec );
 
-      for (i = 0; i <= VBO_ATTRIB_TEX7; i++) {
-	 if (exec->eval.map2[i].map) 
-	    if (exec->vtx.active_sz[i] != exec->eval.map2[i].sz)
-	       vbo_exec_fixup_vertex( ctx, i, exec->eval.map2[i].sz );
-      }
-
-      if (ctx->Eval.AutoNormal) 
-	 if (exec->vtx.active_sz[VBO_ATTRIB_NORMAL] != 3)
-	    vbo_exec_fixup_vertex( ctx, VBO_ATTRIB_NORMAL, 3 );
-   }
+   vbo_exec_eval2_fixup_vertex( ctx );
 
    _mesa_memcpy( exec->vtx.copied.buffer, exec->vtx.vertex, 
                  exec->vtx.vertex_size * sizeof(GLfloat));
@@ -566,6 +573,140 @@ static void GLAPIENTRY vbo_exec_End( void )
 }
 
 
+/* Emit one precomputed glEvalMesh2 grid point straight into the
+ * vertex buffer, as vbo_exec_do_EvalCoord2f() followed by
+ * glVertex would.
+ */
+static INLINE void vbo_exec_emit_mesh_vertex( struct vbo_exec_context *exec,
+					      const GLfloat *data )
+{
+   GLuint i;
+
+   for (i = 0; i < exec->eval.mesh_nr_attr; i++, data += 4) {
+      const GLuint attr = exec->eval.mesh_attr[i];
+      COPY_SZ_4V( exec->vtx.attrptr[attr], exec->vtx.attrsz[attr], data );
+   }
+
+   for (i = 0; i < exec->vtx.vertex_size; i++)
+      exec->vtx.vbptr[i] = exec->vtx.vertex[i];
+
+   exec->vtx.vbptr += exec->vtx.vertex_size;
+   exec->ctx->Driver.NeedFlush |= FLUSH_STORED_VERTICES;
+
+   if (++exec->vtx.vert_count >= exec->vtx.max_vert)
+      vbo_exec_vtx_wrap( exec );
+}
+
+/* Begin/End are called directly rather than through the dispatch,
+ * which is the display list one under GL_COMPILE_AND_EXECUTE.
+ */
+static GLboolean vbo_exec_mesh_begin( GLcontext *ctx, GLenum prim )
+{
+   vbo_exec_Begin( prim );
+   return ctx->Driver.CurrentExecPrimitive != PRIM_OUTSIDE_BEGIN_END;
+}
+
+/* Evaluate the whole grid once, each point a single time, then emit
+ * it directly rather than going through glEvalCoord2f per vertex.
+ * Shared rows of adjacent strips are no longer evaluated twice, and
+ * the grid is reused as long as the maps and grid are unchanged.
+ */
+static void GLAPIENTRY vbo_exec_EvalMesh2( GLenum mode,
+					   GLint i1, GLint i2,
+					   GLint j1, GLint j2 )
+{
+   GET_CURRENT_CONTEXT( ctx );
+   struct vbo_exec_context *exec = &vbo_context(ctx)->exec;
+   GLfloat saved[VBO_ATTRIB_MAX * 4];
+   const GLfloat *grid;
+   GLint nu, nv, stride, i, j;
+
+   switch (mode) {
+   case GL_POINT:
+   case GL_LINE:
+   case GL_FILL:
+      break;
+   default:
+      _mesa_error( ctx, GL_INVALID_ENUM, "glEvalMesh2(mode)" );
+      return;
+   }
+
+   if (ctx->Driver.CurrentExecPrimitive != PRIM_OUTSIDE_BEGIN_END) {
+      _mesa_error( ctx, GL_INVALID_OPERATION, "glEvalMesh2" );
+      return;
+   }
+
+   /* Pick up pending map and grid changes before looking at the
+    * cached grid.
+    */
+   if (ctx->NewState)
+      _mesa_update_state( ctx );
+
+   if (exec->eval.recalculate_maps) 
+      vbo_exec_eval_update( exec );
+
+   /* No effect if vertex maps disabled.
+    */
+   if (!exec->eval.map2[0].map || i2 < i1 || j2 < j1)
+      return;
+
+   grid = vbo_exec_eval_mesh2( exec, i1, i2, j1, j2 );
+   if (!grid) {
+      _mesa_noop_EvalMesh2( mode, i1, i2, j1, j2 );
+      return;
+   }
+
+   vbo_exec_eval2_fixup_vertex( ctx );
+
+   _mesa_memcpy( saved, exec->vtx.vertex, 
+                 exec->vtx.vertex_size * sizeof(GLfloat));
+
+   nu = i2 - i1 + 1;
+   nv = j2 - j1 + 1;
+   stride = exec->eval.mesh_nr_attr * 4;
+
+   switch (mode) {
+   case GL_POINT:
+      if (vbo_exec_mesh_begin( ctx, GL_POINTS )) {
+	 for (i = 0; i < nu * nv; i++)
+	    vbo_exec_emit_mesh_vertex( exec, grid + i * stride );
+	 vbo_exec_End();
+      }
+      break;
+   case GL_LINE:
+      for (j = 0; j < nv; j++) {
+	 if (!vbo_exec_mesh_begin( ctx, GL_LINE_STRIP ))
+	    break;
+	 for (i = 0; i < nu; i++)
+	    vbo_exec_emit_mesh_vertex( exec, grid + (j * nu + i) * stride );
+	 vbo_exec_End();
+      }
+      for (i = 0; i < nu; i++) {
+	 if (!vbo_exec_mesh_begin( ctx, GL_LINE_STRIP ))
+	    break;
+	 for (j = 0; j < nv; j++)
+	    vbo_exec_emit_mesh_vertex( exec, grid + (j * nu + i) * stride );
+	 vbo_exec_End();
+      }
+      break;
+   case GL_FILL:
+      for (j = 0; j < nv - 1; j++) {
+	 if (!vbo_exec_mesh_begin( ctx, GL_TRIANGLE_STRIP ))
+	    break;
+	 for (i = 0; i < nu; i++) {
+	    vbo_exec_emit_mesh_vertex( exec, grid + (j * nu + i) * stride );
+	    vbo_exec_emit_mesh_vertex( exec, grid + ((j + 1) * nu + i) * stride );
+	 }
+	 vbo_exec_End();
+      }
+      break;
+   }
+
+   _mesa_memcpy( exec->vtx.vertex, saved, 
+                 exec->vtx.vertex_size * sizeof(GLfloat));
+}
+
+
 static void vbo_exec_vtxfmt_init( struct vbo_exec_context *exec )
 {
    GLvertexformat *vfmt = &exec->vtxfmt;
@@ -586,7 +727,7 @@ static void vbo_exec_vtxfmt_init( struct vbo_exec_context *exec )
 
    vfmt->Rectf = _mesa_noop_Rectf;
    vfmt->EvalMesh1 = _mesa_noop_EvalMesh1;
-   vfmt->EvalMesh2 = _mesa_noop_EvalMesh2;
+   vfmt->EvalMesh2 = vbo_exec_EvalMesh2;
 
 
    /* from attrib_tmp.h:
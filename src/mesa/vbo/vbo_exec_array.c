@@ -27,9 +27,12 @@
 
 #include "main/glheader.h"
 #include "main/context.h"
+#include "main/macros.h"
 #include "main/state.h"
 #include "main/api_validate.h"
 #include "main/api_noop.h"
+#include "shader/prog_parameter.h"
+#include "shader/prog_statevars.h"
 
 #include "vbo_context.h"
 
@@ -377,6 +380,527 @@ vbo_exec_DrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *ind
    vbo_exec_DrawRangeElements(mode, min_index, max_index, count, type, indices);
 }
 
+/**
+ * Pass the primitives of a glMultiDraw*() call to the driver in as few
+ * draw_prims() calls as possible.  Consecutive prims are batched as long
+ * as the range of vertices they reference fits in a locked array range
+ * (which is what the software tnl module can transform in one go) and
+ * isn't mostly unused, so vertices don't need to be split out or
+ * transformed for nothing.  Indexed prims are only batched when their
+ * indices follow each other, since the batch's index buffer is a single
+ * contiguous range.
+ *
+ * \param min_index  per-prim lowest vertex referenced
+ * \param max_index  per-prim highest vertex referenced
+ * \param ib  index buffer for indexed prims, or NULL
+ * \param index_size  size of an index in bytes
+ */
+static void
+vbo_draw_prim_batches( GLcontext *ctx,
+		       struct _mesa_prim *prim, GLuint nr_prims,
+		       const GLuint *min_index, const GLuint *max_index,
+		       const struct _mesa_index_buffer *ib,
+		       GLuint index_size )
+{
+   struct vbo_context *vbo = vbo_context(ctx);
+   struct vbo_exec_context *exec = &vbo->exec;
+   const GLuint max_range = ctx->Const.MaxArrayLockSize;
+   GLuint first = 0;
+
+   while (first < nr_prims) {
+      GLuint min = min_index[first], max = max_index[first];
+      GLuint nr_verts = max - min + 1;
+      GLuint last;
+
+      for (last = first + 1; last < nr_prims; last++) {
+	 const GLuint new_min = MIN2(min, min_index[last]);
+	 const GLuint new_max = MAX2(max, max_index[last]);
+	 const GLuint new_verts = nr_verts + max_index[last] - min_index[last] + 1;
+
+	 if (new_max - new_min + 1 > max_range ||
+	     new_max - new_min + 1 > 2 * new_verts)
+	    break;
+
+	 if (ib &&
+	     prim[last].start != prim[last - 1].start + prim[last - 1].count)
+	    break;
+
+	 min = new_min;
+	 max = new_max;
+	 nr_verts = new_verts;
+      }
+
+      if (ib) {
+	 /* Make the batch's index buffer start at its first index */
+	 struct _mesa_index_buffer batch_ib;
+	 const GLuint start = prim[first].start;
+	 const GLuint end = prim[last - 1].start + prim[last - 1].count;
+	 GLuint i;
+
+	 for (i = first; i < last; i++)
+	    prim[i].start -= start;
+
+	 batch_ib.count = end - start;
+	 batch_ib.type = ib->type;
+	 batch_ib.obj = ib->obj;
+	 batch_ib.ptr = ADD_POINTERS(ib->ptr, start * index_size);
+
+	 vbo->draw_prims( ctx, exec->array.inputs, &prim[first], last - first,
+			  &batch_ib, min, max );
+      }
+      else {
+	 vbo->draw_prims( ctx, exec->array.inputs, &prim[first], last - first,
+			  NULL, min, max );
+      }
+
+      first = last;
+   }
+}
+
+
+/**
+ * Called via glMultiDrawArraysEXT().  Rather than looping over
+ * glDrawArrays(), the sub-draws are passed to the driver as lists of
+ * primitives, so state validation and array binding are done only once
+ * and the software tnl module transforms many of them per pipeline run.
+ */
+static void GLAPIENTRY
+vbo_exec_MultiDrawArrays(GLenum mode, GLint *first,
+			 GLsizei *count, GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct _mesa_prim *prim;
+   GLuint *min_index;
+   GLint i, nr_prims = 0;
+
+   ASSERT_OUTSIDE_BEGIN_END_AND_FLUSH(ctx);
+
+   if (primcount <= 0)
+      return;
+
+   prim = (struct _mesa_prim *) _mesa_malloc(primcount * sizeof(*prim));
+   min_index = (GLuint *) _mesa_malloc(2 * primcount * sizeof(GLuint));
+   if (!prim || !min_index) {
+      if (prim)
+	 _mesa_free(prim);
+      if (min_index)
+	 _mesa_free(min_index);
+      _mesa_error(ctx, GL_OUT_OF_MEMORY, "glMultiDrawArraysEXT");
+      return;
+   }
+
+   for (i = 0; i < primcount; i++) {
+      if (count[i] <= 0 ||
+          !_mesa_validate_DrawArrays( ctx, mode, first[i], count[i] ))
+	 continue;
+
+      prim[nr_prims].begin = 1;
+      prim[nr_prims].end = 1;
+      prim[nr_prims].weak = 0;
+      prim[nr_prims].pad = 0;
+      prim[nr_prims].mode = mode;
+      prim[nr_prims].start = first[i];
+      prim[nr_prims].count = count[i];
+      prim[nr_prims].indexed = 0;
+      nr_prims++;
+   }
+
+   if (nr_prims > 0) {
+      FLUSH_CURRENT( ctx, 0 );
+
+      if (ctx->NewState)
+	 _mesa_update_state( ctx );
+
+      if (!vbo_validate_shaders(ctx)) {
+	 _mesa_error(ctx, GL_INVALID_OPERATION,
+		     "glMultiDrawArraysEXT(bad shader)");
+      }
+      else {
+	 GLuint *max_index = min_index + primcount;
+
+	 for (i = 0; i < nr_prims; i++) {
+	    min_index[i] = prim[i].start;
+	    max_index[i] = prim[i].start + prim[i].count - 1;
+	 }
+
+	 bind_arrays( ctx );
+	 vbo_draw_prim_batches( ctx, prim, nr_prims, min_index, max_index,
+				NULL, 0 );
+      }
+   }
+
+   _mesa_free(min_index);
+   _mesa_free(prim);
+}
+
+
+/**
+ * Called via glMultiDrawElementsEXT().  As above, but the prims are
+ * indexed.  If the indices live in a buffer object and are suitably
+ * aligned, the prims point straight into that buffer, otherwise the
+ * indices are gathered into one temporary array.
+ */
+static void GLAPIENTRY
+vbo_exec_MultiDrawElements(GLenum mode, const GLsizei *count, GLenum type,
+			   const GLvoid **indices, GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct gl_buffer_object *elementBuf = ctx->Array.ElementArrayBufferObj;
+   struct _mesa_index_buffer ib;
+   struct _mesa_prim *prim;
+   const GLvoid **prim_indices;
+   GLuint *min_index, *max_index;
+   const GLubyte *map = NULL;
+   GLubyte *tmp_indices = NULL;
+   GLuint index_size, nr_indices = 0;
+   GLboolean in_place;
+   GLint i, nr_prims = 0;
+
+   ASSERT_OUTSIDE_BEGIN_END_AND_FLUSH(ctx);
+
+   if (primcount <= 0)
+      return;
+
+   switch (type) {
+   case GL_UNSIGNED_INT:
+      index_size = sizeof(GLuint);
+      break;
+   case GL_UNSIGNED_SHORT:
+      index_size = sizeof(GLushort);
+      break;
+   case GL_UNSIGNED_BYTE:
+      index_size = sizeof(GLubyte);
+      break;
+   default:
+      _mesa_error(ctx, GL_INVALID_ENUM, "glMultiDrawElementsEXT(type)");
+      return;
+   }
+
+   prim = (struct _mesa_prim *) _mesa_malloc(primcount * sizeof(*prim));
+   prim_indices = (const GLvoid **) _mesa_malloc(primcount * sizeof(GLvoid *));
+   min_index = (GLuint *) _mesa_malloc(2 * primcount * sizeof(GLuint));
+   if (!prim || !prim_indices || !min_index) {
+      if (prim)
+	 _mesa_free(prim);
+      if (prim_indices)
+	 _mesa_free((void *) prim_indices);
+      if (min_index)
+	 _mesa_free(min_index);
+      _mesa_error(ctx, GL_OUT_OF_MEMORY, "glMultiDrawElementsEXT");
+      return;
+   }
+   max_index = min_index + primcount;
+
+   /* Validate the sub-draws and see whether the prims can refer to the
+    * bound element buffer directly.
+    */
+   in_place = elementBuf->Name != 0;
+   for (i = 0; i < primcount; i++) {
+      if (count[i] <= 0 ||
+          !_mesa_validate_DrawElements( ctx, mode, count[i], type, indices[i] ))
+	 continue;
+
+      prim[nr_prims].begin = 1;
+      prim[nr_prims].end = 1;
+      prim[nr_prims].weak = 0;
+      prim[nr_prims].pad = 0;
+      prim[nr_prims].mode = mode;
+      prim[nr_prims].count = count[i];
+      prim[nr_prims].indexed = 1;
+
+      if (in_place && (uintptr_t) indices[i] % index_size == 0)
+	 prim[nr_prims].start = (GLuint) ((uintptr_t) indices[i] / index_size);
+      else
+	 in_place = GL_FALSE;
+
+      prim_indices[nr_prims] = indices[i];
+      nr_prims++;
+   }
+
+   if (nr_prims == 0)
+      goto done;
+
+   if (elementBuf->Name) {
+      map = (const GLubyte *) ctx->Driver.MapBuffer(ctx,
+						    GL_ELEMENT_ARRAY_BUFFER_ARB,
+						    GL_READ_ONLY,
+						    elementBuf);
+      if (!map) {
+	 /* Can't read the indices to batch the prims, so draw them one
+	  * at a time like _mesa_MultiDrawElementsEXT() does.
+	  */
+	 for (i = 0; i < primcount; i++) {
+	    if (count[i] > 0)
+	       vbo_exec_DrawElements(mode, count[i], type, indices[i]);
+	 }
+	 goto done;
+      }
+   }
+
+   if (!in_place) {
+      /* Gather the indices into one array */
+      for (i = 0; i < nr_prims; i++)
+	 nr_indices += prim[i].count;
+
+      tmp_indices = (GLubyte *) _mesa_malloc(nr_indices * index_size);
+      if (!tmp_indices) {
+	 _mesa_error(ctx, GL_OUT_OF_MEMORY, "glMultiDrawElementsEXT");
+	 if (map)
+	    ctx->Driver.UnmapBuffer(ctx, GL_ELEMENT_ARRAY_BUFFER_ARB,
+				    elementBuf);
+	 goto done;
+      }
+
+      nr_indices = 0;
+      for (i = 0; i < nr_prims; i++) {
+	 const GLvoid *src = prim_indices[i];
+	 if (map)
+	    src = ADD_POINTERS(map, src);
+	 prim[i].start = nr_indices;
+	 _mesa_memcpy(tmp_indices + nr_indices * index_size, src,
+		      prim[i].count * index_size);
+	 nr_indices += prim[i].count;
+      }
+   }
+
+   /* Find the range of vertices referenced by each sub-draw */
+   for (i = 0; i < nr_prims; i++) {
+      const GLubyte *base = tmp_indices ? tmp_indices : map;
+      get_minmax_index(prim[i].count, type, base + prim[i].start * index_size,
+		       &min_index[i], &max_index[i]);
+   }
+
+   if (map)
+      ctx->Driver.UnmapBuffer(ctx, GL_ELEMENT_ARRAY_BUFFER_ARB, elementBuf);
+
+   FLUSH_CURRENT( ctx, 0 );
+
+   if (ctx->NewState)
+      _mesa_update_state( ctx );
+
+   if (!vbo_validate_shaders(ctx)) {
+      _mesa_error(ctx, GL_INVALID_OPERATION,
+		  "glMultiDrawElementsEXT(bad shader)");
+      goto done;
+   }
+
+   bind_arrays( ctx );
+
+   ib.type = type;
+   if (tmp_indices) {
+      ib.obj = ctx->Array.NullBufferObj;
+      ib.ptr = tmp_indices;
+   }
+   else {
+      ib.obj = elementBuf;
+      ib.ptr = NULL;
+   }
+
+   vbo_draw_prim_batches( ctx, prim, nr_prims, min_index, max_index,
+			  &ib, index_size );
+
+ done:
+   if (tmp_indices)
+      _mesa_free(tmp_indices);
+   _mesa_free(min_index);
+   _mesa_free((void *) prim_indices);
+   _mesa_free(prim);
+}
+
+
+/**
+ * Max number of identical instances passed to one draw_prims() call.
+ */
+#define VBO_MAX_INSTANCE_PRIMS 64
+
+
+/**
+ * Does the current vertex program read gl_InstanceIDARB?
+ */
+static GLboolean
+vbo_program_uses_instance_id( GLcontext *ctx )
+{
+   const struct gl_vertex_program *vp = ctx->VertexProgram._Current;
+   const struct gl_program_parameter_list *params;
+   GLuint i;
+
+   if (!vp || !vp->Base.Parameters)
+      return GL_FALSE;
+
+   params = vp->Base.Parameters;
+   for (i = 0; i < params->NumParameters; i++) {
+      if (params->Parameters[i].Type == PROGRAM_STATE_VAR &&
+          params->Parameters[i].StateIndexes[0] == STATE_INTERNAL &&
+          params->Parameters[i].StateIndexes[1] == STATE_INSTANCE_ID)
+         return GL_TRUE;
+   }
+
+   return GL_FALSE;
+}
+
+
+/**
+ * Draw primcount instances of a single prim.  State has been validated
+ * and the arrays bound by the caller, so that is only done once for all
+ * the instances.
+ *
+ * Arrays with a non-zero divisor (GL_ARB_instanced_arrays) are passed to
+ * the driver as constant (zero stride) arrays pointing at the element for
+ * the current instance.  Consecutive instances which see the same
+ * elements and don't need their instance ID are identical, so they are
+ * drawn as a list of repeated prims with one draw_prims() call, and the
+ * vertices only get transformed once.
+ */
+static void
+vbo_draw_instanced( GLcontext *ctx, const struct _mesa_prim *prim,
+                    const struct _mesa_index_buffer *ib,
+                    GLuint min_index, GLuint max_index, GLsizei primcount )
+{
+   struct vbo_context *vbo = vbo_context(ctx);
+   struct vbo_exec_context *exec = &vbo->exec;
+   const struct gl_client_array **inputs = exec->array.inputs;
+   const struct gl_client_array *inst_inputs[VERT_ATTRIB_MAX];
+   struct gl_client_array inst_array[VERT_ATTRIB_MAX];
+   struct _mesa_prim inst_prim[VBO_MAX_INSTANCE_PRIMS];
+   const GLboolean use_id = vbo_program_uses_instance_id(ctx);
+   GLbitfield divisor_mask = 0;
+   GLsizei instance, n;
+   GLuint i;
+
+   for (i = 0; i < VERT_ATTRIB_MAX; i++) {
+      inst_inputs[i] = inputs[i];
+      if (inputs[i]->Divisor) {
+         inst_array[i] = *inputs[i];
+         inst_array[i].StrideB = 0;
+         inst_inputs[i] = &inst_array[i];
+         divisor_mask |= 1 << i;
+      }
+   }
+
+   for (i = 0; i < VBO_MAX_INSTANCE_PRIMS; i++)
+      inst_prim[i] = *prim;
+
+   for (instance = 0; instance < primcount; instance += n) {
+      n = use_id ? 1 : MIN2(primcount - instance, VBO_MAX_INSTANCE_PRIMS);
+
+      for (i = 0; i < VERT_ATTRIB_MAX; i++) {
+         if (divisor_mask & (1 << i)) {
+            const GLuint divisor = inputs[i]->Divisor;
+            const GLuint element = (GLuint) instance / divisor;
+            const GLsizei left = divisor - (GLuint) instance % divisor;
+
+            inst_array[i].Ptr = inputs[i]->Ptr + element * inputs[i]->StrideB;
+            n = MIN2(n, left);
+         }
+      }
+
+      ctx->Array.InstanceID = instance;
+      vbo->draw_prims( ctx, inst_inputs, inst_prim, n, ib,
+                       min_index, max_index );
+   }
+
+   ctx->Array.InstanceID = 0;
+}
+
+
+static void GLAPIENTRY
+vbo_exec_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count,
+                             GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct _mesa_prim prim;
+
+   if (!_mesa_validate_DrawArraysInstanced( ctx, mode, first, count,
+                                            primcount ))
+      return;
+
+   FLUSH_CURRENT( ctx, 0 );
+
+   if (ctx->NewState)
+      _mesa_update_state( ctx );
+
+   if (!vbo_validate_shaders(ctx)) {
+      _mesa_error(ctx, GL_INVALID_OPERATION,
+                  "glDrawArraysInstancedARB(bad shader)");
+      return;
+   }
+
+   bind_arrays( ctx );
+
+   prim.begin = 1;
+   prim.end = 1;
+   prim.weak = 0;
+   prim.pad = 0;
+   prim.mode = mode;
+   prim.start = first;
+   prim.count = count;
+   prim.indexed = 0;
+
+   vbo_draw_instanced( ctx, &prim, NULL, first, first + count - 1,
+                       primcount );
+}
+
+
+static void GLAPIENTRY
+vbo_exec_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type,
+                               const GLvoid *indices, GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct _mesa_index_buffer ib;
+   struct _mesa_prim prim;
+   GLuint min_index = 0;
+   GLuint max_index = 0;
+
+   if (!_mesa_validate_DrawElementsInstanced( ctx, mode, count, type,
+                                              indices, primcount ))
+      return;
+
+   FLUSH_CURRENT( ctx, 0 );
+
+   if (ctx->NewState)
+      _mesa_update_state( ctx );
+
+   if (!vbo_validate_shaders(ctx)) {
+      _mesa_error(ctx, GL_INVALID_OPERATION,
+                  "glDrawElementsInstancedARB(bad shader)");
+      return;
+   }
+
+   if (ctx->Array.ElementArrayBufferObj->Name) {
+      const GLvoid *map = ctx->Driver.MapBuffer(ctx,
+						 GL_ELEMENT_ARRAY_BUFFER_ARB,
+						 GL_READ_ONLY,
+						 ctx->Array.ElementArrayBufferObj);
+
+      get_minmax_index(count, type, ADD_POINTERS(map, indices), &min_index, &max_index);
+
+      ctx->Driver.UnmapBuffer(ctx,
+			      GL_ELEMENT_ARRAY_BUFFER_ARB,
+			      ctx->Array.ElementArrayBufferObj);
+   }
+   else {
+      get_minmax_index(count, type, indices, &min_index, &max_index);
+   }
+
+   bind_arrays( ctx );
+
+   ib.count = count;
+   ib.type = type;
+   ib.obj = ctx->Array.ElementArrayBufferObj;
+   ib.ptr = indices;
+
+   prim.begin = 1;
+   prim.end = 1;
+   prim.weak = 0;
+   prim.pad = 0;
+   prim.mode = mode;
+   prim.start = 0;
+   prim.count = count;
+   prim.indexed = 1;
+
+   vbo_draw_instanced( ctx, &prim, &ib, min_index, max_index, primcount );
+}
+
 
 /***********************************************************************
  * Initialization
@@ -391,10 +915,18 @@ void vbo_exec_array_init( struct vbo_exec_context *exec )
    exec->vtxfmt.DrawArrays = vbo_exec_DrawArrays;
    exec->vtxfmt.DrawElements = vbo_exec_DrawElements;
    exec->vtxfmt.DrawRangeElements = vbo_exec_DrawRangeElements;
+   exec->vtxfmt.MultiDrawArraysEXT = vbo_exec_MultiDrawArrays;
+   exec->vtxfmt.MultiDrawElementsEXT = vbo_exec_MultiDrawElements;
+   exec->vtxfmt.DrawArraysInstancedARB = vbo_exec_DrawArraysInstanced;
+   exec->vtxfmt.DrawElementsInstancedARB = vbo_exec_DrawElementsInstanced;
 #else
    exec->vtxfmt.DrawArrays = _mesa_noop_DrawArrays;
    exec->vtxfmt.DrawElements = _mesa_noop_DrawElements;
    exec->vtxfmt.DrawRangeElements = _mesa_noop_DrawRangeElements;
+   exec->vtxfmt.MultiDrawArraysEXT = _mesa_noop_MultiDrawArraysEXT;
+   exec->vtxfmt.MultiDrawElementsEXT = _mesa_noop_MultiDrawElementsEXT;
+   exec->vtxfmt.DrawArraysInstancedARB = _mesa_noop_DrawArraysInstancedARB;
+   exec->vtxfmt.DrawElementsInstancedARB = _mesa_noop_DrawElementsInstancedARB;
 #endif
 }
 
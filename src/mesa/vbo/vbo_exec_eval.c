@@ -252,3 +252,171 @@ void vbo_exec_do_EvalCoord2f( struct vbo_exec_context *exec,
 }
 
 
+
+
+/* Evaluate one row (constant v) of a 2D map at nu grid points starting
+ * at u.  The control net is first reduced to a curve in u for this
+ * row, so every point costs a single Horner evaluation in u instead
+ * of a full surface evaluation.  If normal is non-null the partial
+ * derivatives are reduced the same way and the autonormal is stored
+ * there.
+ */
+static void eval_mesh2_row( const struct gl_2d_map *map, GLuint sz,
+			    GLfloat u, GLfloat du, GLuint nu, GLfloat v,
+			    GLfloat *dest, GLfloat *normal, GLuint stride )
+{
+   const GLuint uorder = map->Uorder, vorder = map->Vorder;
+   const GLuint uinc = vorder * sz;
+   const GLfloat vv = (v - map->v1) * map->dv;
+   GLfloat cp[MAX_EVAL_ORDER * 4];	/* surface curve in u */
+   GLfloat ducp[MAX_EVAL_ORDER * 4];	/* its difference polygon */
+   GLfloat dvcp[MAX_EVAL_ORDER * 4];	/* curve of the v derivatives */
+   GLuint i, k;
+
+   for (i = 0; i < uorder; i++)
+      _math_horner_bezier_curve(map->Points + i * uinc, cp + i * sz, vv,
+				sz, vorder);
+
+   if (normal) {
+      GLfloat diff[MAX_EVAL_ORDER * 4];
+
+      for (i = 0; i < uorder; i++) {
+	 const GLfloat *col = map->Points + i * uinc;
+
+	 if (vorder > 1) {
+	    for (k = 0; k < (vorder - 1) * sz; k++)
+	       diff[k] = col[k + sz] - col[k];
+	    _math_horner_bezier_curve(diff, dvcp + i * sz, vv,
+				      sz, vorder - 1);
+	 }
+	 else {
+	    for (k = 0; k < sz; k++)
+	       dvcp[i * sz + k] = 0.0F;
+	 }
+      }
+
+      for (k = 0; k + sz < uorder * sz; k++)
+	 ducp[k] = cp[k + sz] - cp[k];
+   }
+
+   for (i = 0; i < nu; i++, u += du, dest += stride) {
+      const GLfloat uu = (u - map->u1) * map->du;
+
+      ASSIGN_4V(dest, 0, 0, 0, 1);
+      _math_horner_bezier_curve(cp, dest, uu, sz, uorder);
+
+      if (normal) {
+	 GLfloat *n = normal + i * stride;
+	 GLfloat ddu[4], ddv[4];
+
+	 ASSIGN_4V(ddu, 0, 0, 0, 0);
+	 if (uorder > 1)
+	    _math_horner_bezier_curve(ducp, ddu, uu, sz, uorder - 1);
+	 _math_horner_bezier_curve(dvcp, ddv, uu, sz, uorder);
+
+	 if (sz == 4) {
+	    ddu[0] = ddu[0]*dest[3] - ddu[3]*dest[0];
+	    ddu[1] = ddu[1]*dest[3] - ddu[3]*dest[1];
+	    ddu[2] = ddu[2]*dest[3] - ddu[3]*dest[2];
+
+	    ddv[0] = ddv[0]*dest[3] - ddv[3]*dest[0];
+	    ddv[1] = ddv[1]*dest[3] - ddv[3]*dest[1];
+	    ddv[2] = ddv[2]*dest[3] - ddv[3]*dest[2];
+	 }
+
+	 CROSS3(n, ddu, ddv);
+	 NORMALIZE_3FV(n);
+	 n[3] = 1.0;
+      }
+   }
+}
+
+
+/**
+ * Evaluate the active 2D maps at every point of the MapGrid2 sub-grid
+ * [i1,i2] x [j1,j2], row by row, using the same parameter stepping as
+ * a sequence of glEvalCoord2f calls would.  The result is kept in
+ * exec->eval.mesh and returned directly while the maps, grid and mesh
+ * bounds are unchanged.  Returns NULL if the grid can't be allocated.
+ */
+const GLfloat *vbo_exec_eval_mesh2( struct vbo_exec_context *exec,
+				    GLint i1, GLint i2, GLint j1, GLint j2 )
+{
+   GLcontext *ctx = exec->ctx;
+   const GLuint nu = i2 - i1 + 1, nv = j2 - j1 + 1;
+   const GLfloat du = ctx->Eval.MapGrid2du;
+   const GLfloat dv = ctx->Eval.MapGrid2dv;
+   const GLfloat u1 = ctx->Eval.MapGrid2u1 + i1 * du;
+   GLfloat v = ctx->Eval.MapGrid2v1 + j1 * dv;
+   GLint normal_slot = -1;
+   GLuint attr, stride, size, n, j, k;
+
+   if (exec->eval.mesh_valid &&
+       exec->eval.mesh_i1 == i1 && exec->eval.mesh_i2 == i2 &&
+       exec->eval.mesh_j1 == j1 && exec->eval.mesh_j2 == j2)
+      return exec->eval.mesh;
+
+   exec->eval.mesh_valid = GL_FALSE;
+
+   /* The autonormal replaces any normal map, as in EvalCoord2f.
+    */
+   n = 0;
+   for (attr = 1; attr <= VBO_ATTRIB_TEX7; attr++) {
+      if (attr == VBO_ATTRIB_NORMAL && ctx->Eval.AutoNormal)
+	 normal_slot = n;
+      else if (!exec->eval.map2[attr].map)
+	 continue;
+      exec->eval.mesh_attr[n++] = attr;
+   }
+   exec->eval.mesh_attr[n++] = VBO_ATTRIB_POS;
+   exec->eval.mesh_nr_attr = n;
+
+   stride = n * 4;
+   if (nu > ~0u / stride / nv)
+      return NULL;
+   size = nu * nv * stride;
+
+   if (size > exec->eval.mesh_size) {
+      if (exec->eval.mesh)
+	 _mesa_free(exec->eval.mesh);
+      exec->eval.mesh = (GLfloat *) _mesa_malloc(size * sizeof(GLfloat));
+      exec->eval.mesh_size = exec->eval.mesh ? size : 0;
+      if (!exec->eval.mesh)
+	 return NULL;
+   }
+
+   for (j = 0; j < nv; j++, v += dv) {
+      GLfloat *row = exec->eval.mesh + j * nu * stride;
+
+      for (k = 0; k < n; k++) {
+	 GLfloat *normal = NULL;
+
+	 attr = exec->eval.mesh_attr[k];
+	 if ((GLint) k == normal_slot)
+	    continue;
+	 if (attr == VBO_ATTRIB_POS && normal_slot >= 0)
+	    normal = row + normal_slot * 4;
+
+	 eval_mesh2_row(exec->eval.map2[attr].map, exec->eval.map2[attr].sz,
+			u1, du, nu, v, row + k * 4, normal, stride);
+      }
+   }
+
+   exec->eval.mesh_i1 = i1;
+   exec->eval.mesh_i2 = i2;
+   exec->eval.mesh_j1 = j1;
+   exec->eval.mesh_j2 = j2;
+   exec->eval.mesh_valid = GL_TRUE;
+   return exec->eval.mesh;
+}
+
+
+void vbo_exec_eval_destroy( struct vbo_exec_context *exec )
+{
+   if (exec->eval.mesh) {
+      _mesa_free(exec->eval.mesh);
+      exec->eval.mesh = NULL;
+   }
+   exec->eval.mesh_size = 0;
+   exec->eval.mesh_valid = GL_FALSE;
+}
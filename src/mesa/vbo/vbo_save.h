@@ -73,6 +73,12 @@ struct vbo_save_vertex_list {
    struct _mesa_prim *prim;
    GLuint prim_count;
 
+   /* If non-NULL, identical vertices have been welded together and the
+    * primitives index the vertices through this array.
+    */
+   GLushort *indices;
+   GLuint index_count;
+
    struct vbo_save_vertex_store *vertex_store;
    struct vbo_save_primitive_store *prim_store;
 };
@@ -158,6 +164,7 @@ void vbo_loopback_vertex_list( GLcontext *ctx,
 			       const GLubyte *attrsz,
 			       const struct _mesa_prim *prim,
 			       GLuint prim_count,
+			       const GLushort *indices,
 			       GLuint wrap_count,
 			       GLuint vertex_size);
 
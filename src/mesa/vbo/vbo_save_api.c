@@ -256,6 +256,113 @@ static void _save_reset_counters( GLcontext *ctx )
 }
 
 
+/* Weld identical vertices of a newly compiled vertex list together:
+ * they are stored once, and the primitives are turned into indexed
+ * primitives which reference them.  The primitive types stay the same,
+ * so flat shading, edge flags and unfilled polygons work as before.
+ *
+ * Vertices are only welded if they are bitwise identical, so
+ * the list renders exactly as it did.  The unique vertices are
+ * moved down, in order of first use, to the start of the list's storage.
+ * This is only done if it saves memory.  It also saves work on playback,
+ * since each vertex is only transformed once.  Returns GL_TRUE if the
+ * list was welded.
+ */
+static GLboolean _save_weld_vertex_list( GLcontext *ctx,
+					 struct vbo_save_vertex_list *node,
+					 GLfloat *buffer )
+{
+   const GLuint sz = node->vertex_size;
+   const GLuint count = node->count;
+   GLuint hash_size, hash_mask, nr_unique = 0, i;
+   GLint *hash;
+   GLuint *unique;
+   GLushort *indices;
+   (void) ctx;
+
+   if (count < 8 || count > 0xffff)
+      return GL_FALSE;
+
+   for (i = 0 ; i < node->prim_count ; i++) {
+      if (node->prim[i].weak)
+	 return GL_FALSE;
+   }
+
+   for (hash_size = 16 ; hash_size < 2 * count ; hash_size *= 2)
+      ;
+   hash_mask = hash_size - 1;
+
+   hash = (GLint *) MALLOC(hash_size * sizeof(GLint));
+   unique = (GLuint *) MALLOC(count * sizeof(GLuint));
+   indices = (GLushort *) MALLOC(count * sizeof(GLushort));
+   if (!hash || !unique || !indices) {
+      FREE(hash);
+      FREE(unique);
+      FREE(indices);
+      return GL_FALSE;
+   }
+
+   for (i = 0 ; i < hash_size ; i++)
+      hash[i] = -1;
+
+   /* Find the unique vertices, in order of first use.
+    */
+   for (i = 0 ; i < count ; i++) {
+      const GLuint *v = (const GLuint *) (buffer + i * sz);
+      GLuint h = 2166136261u, j;
+
+      for (j = 0 ; j < sz ; j++)
+	 h = (h ^ v[j]) * 16777619u;
+
+      for (j = h & hash_mask ; hash[j] >= 0 ; j = (j + 1) & hash_mask) {
+	 if (_mesa_memcmp(buffer + unique[hash[j]] * sz, v,
+			  sz * sizeof(GLfloat)) == 0)
+	    break;
+      }
+
+      if (hash[j] < 0) {
+	 hash[j] = nr_unique;
+	 unique[nr_unique++] = i;
+      }
+      indices[i] = hash[j];
+   }
+
+   FREE(hash);
+
+   /* Is it worth it?
+    */
+   if (nr_unique * sz * sizeof(GLfloat) + count * sizeof(GLushort) >=
+       count * sz * sizeof(GLfloat)) {
+      FREE(unique);
+      FREE(indices);
+      return GL_FALSE;
+   }
+
+   /* Move the unique vertices down.  unique[i] >= i, and the vertices
+    * are moved in order, so nothing is overwritten before it's moved.
+    */
+   for (i = 0 ; i < nr_unique ; i++) {
+      if (unique[i] != i)
+	 _mesa_memcpy(buffer + i * sz, buffer + unique[i] * sz,
+		      sz * sizeof(GLfloat));
+   }
+
+   FREE(unique);
+
+   /* The primitives' start and count index the index array now, which
+    * is in the original vertex order.  So do the wrap_count vertices
+    * copied from the previous list, which loopback skips.
+    */
+   for (i = 0 ; i < node->prim_count ; i++)
+      node->prim[i].indexed = 1;
+
+   node->indices = indices;
+   node->index_count = count;
+   node->count = nr_unique;
+   return GL_TRUE;
+}
+
+
 /* Insert the active immediate struct onto the display list currently
  * being built.
  */
@@ -283,6 +390,8 @@ static void _save_compile_vertex_list( GLcontext *ctx )
    node->dangling_attr_ref = save->dangling_attr_ref;
    node->prim = save->prim;
    node->prim_count = save->prim_count;
+   node->indices = NULL;
+   node->index_count = 0;
    node->vertex_store = save->vertex_store;
    node->prim_store = save->prim_store;
 
@@ -317,12 +426,21 @@ static void _save_compile_vertex_list( GLcontext *ctx )
 				node->attrsz,
 				node->prim,
 				node->prim_count,
+				NULL,
 				node->wrap_count,
 				node->vertex_size);
 
       _glapi_set_dispatch(dispatch);
    }
 
+   /* Share identical vertices, and give back the space saved.
+    */
+   if (_save_weld_vertex_list( ctx, node, save->buffer )) {
+      GLuint saved = (node->index_count - node->count) * save->vertex_size;
+      save->vertex_store->used -= saved;
+      save->vbptr -= saved;
+   }
+
 
    /* Decide whether the storage structs are full, or can be used for
     * the next vertex lists as well.
@@ -793,6 +911,45 @@ static void GLAPIENTRY _save_DrawArrays(GLenum mode, GLint start, GLsizei count)
    _mesa_compile_error( ctx, GL_INVALID_OPERATION, "glDrawArrays" );
 }
 
+static void GLAPIENTRY _save_MultiDrawArrays(GLenum mode, GLint *first,
+					     GLsizei *count, GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   (void) mode; (void) first; (void) count; (void) primcount;
+   _mesa_compile_error( ctx, GL_INVALID_OPERATION, "glMultiDrawArraysEXT" );
+}
+
+static void GLAPIENTRY _save_MultiDrawElements(GLenum mode,
+					       const GLsizei *count,
+					       GLenum type,
+					       const GLvoid **indices,
+					       GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   (void) mode; (void) count; (void) type; (void) indices; (void) primcount;
+   _mesa_compile_error( ctx, GL_INVALID_OPERATION, "glMultiDrawElementsEXT" );
+}
+
+static void GLAPIENTRY _save_DrawArraysInstanced(GLenum mode, GLint first,
+						 GLsizei count,
+						 GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   (void) mode; (void) first; (void) count; (void) primcount;
+   _mesa_compile_error( ctx, GL_INVALID_OPERATION, "glDrawArraysInstancedARB" );
+}
+
+static void GLAPIENTRY _save_DrawElementsInstanced(GLenum mode,
+						   GLsizei count,
+						   GLenum type,
+						   const GLvoid *indices,
+						   GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   (void) mode; (void) count; (void) type; (void) indices; (void) primcount;
+   _mesa_compile_error( ctx, GL_INVALID_OPERATION, "glDrawElementsInstancedARB" );
+}
+
 static void GLAPIENTRY _save_Rectf( GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2 )
 {
    GET_CURRENT_CONTEXT(ctx);
@@ -999,6 +1156,10 @@ static void _save_vtxfmt_init( GLcontext *ctx )
    vfmt->DrawArrays = _save_DrawArrays;
    vfmt->DrawElements = _save_DrawElements;
    vfmt->DrawRangeElements = _save_DrawRangeElements;
+   vfmt->MultiDrawArraysEXT = _save_MultiDrawArrays;
+   vfmt->MultiDrawElementsEXT = _save_MultiDrawElements;
+   vfmt->DrawArraysInstancedARB = _save_DrawArraysInstanced;
+   vfmt->DrawElementsInstancedARB = _save_DrawElementsInstanced;
 
 }
 
@@ -1105,6 +1266,88 @@ static void vbo_destroy_vertex_list( GLcontext *ctx, void *data )
 
    if ( --node->prim_store->refcount == 0 )
       FREE( node->prim_store );
+
+   if (node->indices)
+      FREE( node->indices );
+}
+
+
+/**
+ * Merge the vertex list at next_data, which directly follows the one at
+ * data in a display list, into the latter.  This is only possible if the
+ * two lists were compiled one after the other into the same vertex and
+ * primitive stores with the same vertex format, i.e. if only state
+ * changes which the display list optimizer removed separated them.
+ * Playing back the merged list then takes a single draw_prims call.
+ */
+static GLboolean vbo_merge_vertex_list( GLcontext *ctx, void *data,
+					void *next_data )
+{
+   struct vbo_save_vertex_list *node = (struct vbo_save_vertex_list *)data;
+   struct vbo_save_vertex_list *next = (struct vbo_save_vertex_list *)next_data;
+   GLuint i;
+   (void) ctx;
+
+   if (node->vertex_store != next->vertex_store ||
+       node->prim_store != next->prim_store ||
+       node->vertex_size != next->vertex_size ||
+       _mesa_memcmp(node->attrsz, next->attrsz, sizeof(node->attrsz)) != 0)
+      return GL_FALSE;
+
+   /* the vertices and primitives must be contiguous */
+   if (next->buffer_offset != (node->buffer_offset +
+			       node->count * node->vertex_size * sizeof(GLfloat)) ||
+       next->prim != node->prim + node->prim_count)
+      return GL_FALSE;
+
+   /* don't merge primitives which wrap from one list into the next */
+   if (node->prim_count == 0 || !node->prim[node->prim_count - 1].end ||
+       next->prim_count == 0 || !next->prim[0].begin ||
+       next->wrap_count != 0)
+      return GL_FALSE;
+
+   if (node->indices || next->indices) {
+      /* Concatenate the index arrays, using the identity mapping for a
+       * list which isn't indexed.
+       */
+      const GLuint node_indices = node->indices ? node->index_count : node->count;
+      const GLuint next_indices = next->indices ? next->index_count : next->count;
+      GLushort *indices;
+
+      if (node->count + next->count > 0xffff)
+	 return GL_FALSE;
+
+      indices = (GLushort *) MALLOC((node_indices + next_indices) *
+				    sizeof(GLushort));
+      if (!indices)
+	 return GL_FALSE;
+
+      for (i = 0 ; i < node_indices ; i++)
+	 indices[i] = node->indices ? node->indices[i] : i;
+      for (i = 0 ; i < next_indices ; i++)
+	 indices[node_indices + i] = node->count +
+	    (next->indices ? next->indices[i] : i);
+
+      for (i = 0 ; i < node->prim_count ; i++)
+	 node->prim[i].indexed = 1;
+      for (i = 0 ; i < next->prim_count ; i++) {
+	 next->prim[i].start += node_indices;
+	 next->prim[i].indexed = 1;
+      }
+
+      FREE(node->indices);
+      node->indices = indices;
+      node->index_count = node_indices + next_indices;
+   }
+   else {
+      for (i = 0 ; i < next->prim_count ; i++)
+	 next->prim[i].start += node->count;
+   }
+
+   node->count += next->count;
+   node->prim_count += next->prim_count;
+   node->dangling_attr_ref |= next->dangling_attr_ref;
+   return GL_TRUE;
 }
 
 
@@ -1114,10 +1357,11 @@ static void vbo_print_vertex_list( GLcontext *ctx, void *data )
    GLuint i;
    (void) ctx;
 
-   _mesa_debug(NULL, "VBO-VERTEX-LIST, %u vertices %d primitives, %d vertsize\n",
+   _mesa_debug(NULL, "VBO-VERTEX-LIST, %u vertices %d primitives, %d vertsize%s\n",
                node->count,
 	       node->prim_count,
-	       node->vertex_size);
+	       node->vertex_size,
+	       node->indices ? ", indexed" : "");
 
    for (i = 0 ; i < node->prim_count ; i++) {
       struct _mesa_prim *prim = &node->prim[i];
@@ -1166,7 +1410,8 @@ void vbo_save_api_init( struct vbo_save_context *save )
 			  sizeof(struct vbo_save_vertex_list),
 			  vbo_save_playback_vertex_list,
 			  vbo_destroy_vertex_list,
-			  vbo_print_vertex_list );
+			  vbo_print_vertex_list,
+			  vbo_merge_vertex_list );
 
    ctx->Driver.NotifySaveBegin = vbo_save_NotifyBegin;
 
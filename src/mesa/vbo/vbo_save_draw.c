@@ -49,9 +49,14 @@ static void _playback_copy_to_current( GLcontext *ctx,
    GLfloat vertex[VBO_ATTRIB_MAX * 4], *data = vertex;
    GLuint i, offset;
 
-   if (node->count)
+   if (node->count) {
+      /* the last vertex of the last primitive */
+      const GLuint last = (node->indices ?
+			   node->indices[node->index_count - 1] :
+			   node->count - 1);
       offset = (node->buffer_offset + 
-		(node->count-1) * node->vertex_size * sizeof(GLfloat));
+		last * node->vertex_size * sizeof(GLfloat));
+   }
    else
       offset = node->buffer_offset;
 
@@ -176,6 +181,7 @@ static void vbo_save_loopback_vertex_list( GLcontext *ctx,
 			     list->attrsz,
 			     list->prim,
 			     list->prim_count,
+			     list->indices,
 			     list->wrap_count,
 			     list->vertex_size);
 
@@ -229,13 +235,31 @@ void vbo_save_playback_vertex_list( GLcontext *ctx, void *data )
 
       vbo_bind_vertex_list( ctx, node );
 
-      vbo_context(ctx)->draw_prims( ctx, 
-				    save->inputs, 
-				    node->prim, 
-				    node->prim_count,
-				    NULL,
-				    0,	/* Node is a VBO, so this is ok */
-				    node->count - 1);
+      if (node->indices) {
+	 struct _mesa_index_buffer ib;
+
+	 ib.count = node->index_count;
+	 ib.type = GL_UNSIGNED_SHORT;
+	 ib.obj = ctx->Array.NullBufferObj;
+	 ib.ptr = node->indices;
+
+	 vbo_context(ctx)->draw_prims( ctx, 
+				       save->inputs, 
+				       node->prim, 
+				       node->prim_count,
+				       &ib,
+				       0,
+				       node->count - 1);
+      }
+      else {
+	 vbo_context(ctx)->draw_prims( ctx, 
+				       save->inputs, 
+				       node->prim, 
+				       node->prim_count,
+				       NULL,
+				       0,	/* Node is a VBO, so this is ok */
+				       node->count - 1);
+      }
    }
 
    /* Copy to current?
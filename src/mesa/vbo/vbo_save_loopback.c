@@ -85,13 +85,13 @@ struct loopback_attr {
 static void loopback_prim( GLcontext *ctx,
 			   const GLfloat *buffer,
 			   const struct _mesa_prim *prim,
+			   const GLushort *indices,
 			   GLuint wrap_count,
 			   GLuint vertex_size,
 			   const struct loopback_attr *la, GLuint nr )
 {
    GLint start = prim->start;
    GLint end = start + prim->count;
-   const GLfloat *data;
    GLint j;
    GLuint k;
 
@@ -111,9 +111,8 @@ static void loopback_prim( GLcontext *ctx,
       start += wrap_count;
    }
 
-   data = buffer + start * vertex_size;
-
    for (j = start ; j < end ; j++) {
+      const GLfloat *data = buffer + (indices ? indices[j] : j) * vertex_size;
       const GLfloat *tmp = data + la[0].sz;
 
       for (k = 1 ; k < nr ; k++) {
@@ -124,7 +123,6 @@ static void loopback_prim( GLcontext *ctx,
       /* Fire the vertex
        */
       la[0].func( ctx, VBO_ATTRIB_POS, data );
-      data = tmp;
    }
 
    if (prim->end) {
@@ -159,6 +157,7 @@ void vbo_loopback_vertex_list( GLcontext *ctx,
 			       const GLubyte *attrsz,
 			       const struct _mesa_prim *prim,
 			       GLuint prim_count,
+			       const GLushort *indices,
 			       GLuint wrap_count,
 			       GLuint vertex_size)
 {
@@ -185,7 +184,8 @@ void vbo_loopback_vertex_list( GLcontext *ctx,
       }
       else
       {
-	 loopback_prim( ctx, buffer, &prim[i], wrap_count, vertex_size, la, nr );
+	 loopback_prim( ctx, buffer, &prim[i], indices, wrap_count,
+			vertex_size, la, nr );
       }
    }
 }
@@ -42,10 +42,57 @@
 #endif
 
 extern void _mesa_x86_64_cpuid(unsigned int *regs);
+extern unsigned int _mesa_x86_64_xgetbv(void);
 
+DECLARE_XFORM_GROUP( x86_64, 1 )
 DECLARE_XFORM_GROUP( x86_64, 4 )
 DECLARE_XFORM_GROUP( 3dnow, 4 )
 
+extern void _mesa_x86_64_transform_points2_general( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points2_3d( XFORM_ARGS );
+
+extern void _mesa_x86_64_transform_points3_general( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points3_identity( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points3_2d( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points3_3d( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points3_3d_no_rot( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points3_perspective( XFORM_ARGS );
+
+extern void _mesa_x86_64_avx_transform_points3_general( XFORM_ARGS );
+extern void _mesa_x86_64_avx_transform_points4_general( XFORM_ARGS );
+
+extern void _mesa_x86_64_transform_normals( NORM_ARGS );
+extern void _mesa_x86_64_transform_normals_no_rot( NORM_ARGS );
+extern void _mesa_x86_64_transform_rescale_normals( NORM_ARGS );
+extern void _mesa_x86_64_transform_rescale_normals_no_rot( NORM_ARGS );
+extern void _mesa_x86_64_transform_normalize_normals( NORM_ARGS );
+extern void _mesa_x86_64_transform_normalize_normals_no_rot( NORM_ARGS );
+extern void _mesa_x86_64_rescale_normals( NORM_ARGS );
+
+extern GLvector4f * _mesa_x86_64_cliptest_points4( GLvector4f *clip_vec,
+						   GLvector4f *proj_vec,
+						   GLubyte clipMask[],
+						   GLubyte *orMask,
+						   GLubyte *andMask );
+
+extern GLvector4f * _mesa_x86_64_cliptest_points4_np( GLvector4f *clip_vec,
+						      GLvector4f *proj_vec,
+						      GLubyte clipMask[],
+						      GLubyte *orMask,
+						      GLubyte *andMask );
+
+extern GLvector4f * _mesa_x86_64_cliptest_points3( GLvector4f *clip_vec,
+						   GLvector4f *proj_vec,
+						   GLubyte clipMask[],
+						   GLubyte *orMask,
+						   GLubyte *andMask );
+
+extern GLvector4f * _mesa_x86_64_cliptest_points2( GLvector4f *clip_vec,
+						   GLvector4f *proj_vec,
+						   GLubyte clipMask[],
+						   GLubyte *orMask,
+						   GLubyte *andMask );
+
 #else
 /* just to silence warning below */
 #include "x86-64.h"
@@ -92,6 +139,58 @@ void _mesa_init_all_x86_64_transform_asm(void)
 
    message("Initializing x86-64 optimizations\n");
 
+   /* SSE and SSE2 are part of the x86-64 base architecture, so these
+    * don't need a cpuid check.
+    */
+   ASSIGN_XFORM_GROUP( x86_64, 1 );
+
+   /* 2-component points only use SSE for the general and 3D matrices,
+    * 3-component points for every matrix type except 2D_NO_ROT.  For the
+    * other cases the C versions write fewer dest components and are as
+    * fast or faster.
+    */
+   _mesa_transform_tab[2][MATRIX_GENERAL] =
+      _mesa_x86_64_transform_points2_general;
+   _mesa_transform_tab[2][MATRIX_3D] =
+      _mesa_x86_64_transform_points2_3d;
+
+   _mesa_transform_tab[3][MATRIX_GENERAL] =
+      _mesa_x86_64_transform_points3_general;
+   _mesa_transform_tab[3][MATRIX_IDENTITY] =
+      _mesa_x86_64_transform_points3_identity;
+   _mesa_transform_tab[3][MATRIX_2D] =
+      _mesa_x86_64_transform_points3_2d;
+   _mesa_transform_tab[3][MATRIX_3D] =
+      _mesa_x86_64_transform_points3_3d;
+   _mesa_transform_tab[3][MATRIX_3D_NO_ROT] =
+      _mesa_x86_64_transform_points3_3d_no_rot;
+   _mesa_transform_tab[3][MATRIX_PERSPECTIVE] =
+      _mesa_x86_64_transform_points3_perspective;
+
+   /* The C _mesa_normalize_normals() is vectorized well enough by the
+    * compiler that a one-normal-at-a-time SSE loop doesn't beat it.
+    */
+   _mesa_normal_tab[NORM_TRANSFORM] =
+      _mesa_x86_64_transform_normals;
+   _mesa_normal_tab[NORM_TRANSFORM_NO_ROT] =
+      _mesa_x86_64_transform_normals_no_rot;
+   _mesa_normal_tab[NORM_TRANSFORM | NORM_RESCALE] =
+      _mesa_x86_64_transform_rescale_normals;
+   _mesa_normal_tab[NORM_TRANSFORM_NO_ROT | NORM_RESCALE] =
+      _mesa_x86_64_transform_rescale_normals_no_rot;
+   _mesa_normal_tab[NORM_TRANSFORM | NORM_NORMALIZE] =
+      _mesa_x86_64_transform_normalize_normals;
+   _mesa_normal_tab[NORM_TRANSFORM_NO_ROT | NORM_NORMALIZE] =
+      _mesa_x86_64_transform_normalize_normals_no_rot;
+   _mesa_normal_tab[NORM_RESCALE] =
+      _mesa_x86_64_rescale_normals;
+
+   _mesa_clip_tab[4] = _mesa_x86_64_cliptest_points4;
+   _mesa_clip_tab[3] = _mesa_x86_64_cliptest_points3;
+   _mesa_clip_tab[2] = _mesa_x86_64_cliptest_points2;
+   _mesa_clip_np_tab[4] = _mesa_x86_64_cliptest_points4_np;
+   _mesa_clip_np_tab[3] = _mesa_x86_64_cliptest_points3;
+   _mesa_clip_np_tab[2] = _mesa_x86_64_cliptest_points2;
 
    _mesa_transform_tab[4][MATRIX_GENERAL] =
       _mesa_x86_64_transform_points4_general;
@@ -118,7 +217,23 @@ void _mesa_init_all_x86_64_transform_asm(void)
 
    }
 
-   
+   /* AVX needs both the cpu feature bit and the OS saving the ymm state
+    * (OSXSAVE, then XCR0 bits 1 and 2) before a VEX encoding may be used.
+    */
+   regs[0] = 0x00000001;
+   regs[1] = 0x00000000;
+   regs[2] = 0x00000000;
+   regs[3] = 0x00000000;
+   _mesa_x86_64_cpuid(regs);
+   if ((regs[2] & (1U << 27)) && (regs[2] & (1U << 28)) &&
+       (_mesa_x86_64_xgetbv() & 0x6) == 0x6) {
+      message("AVX detected\n");
+      _mesa_transform_tab[3][MATRIX_GENERAL] =
+	  _mesa_x86_64_avx_transform_points3_general;
+      _mesa_transform_tab[4][MATRIX_GENERAL] =
+	  _mesa_x86_64_avx_transform_points4_general;
+   }
+
 #ifdef DEBUG_MATH
    _math_test_all_transform_functions("x86_64");
    _math_test_all_cliptest_functions("x86_64");
@@ -449,6 +449,10 @@ SOURCE=..\..\..\..\src\mesa\main\renderbuffer.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\main\rowthreads.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\swrast\s_aaline.c
 # End Source File
 # Begin Source File
@@ -1223,6 +1227,10 @@ SOURCE=..\..\..\..\src\mesa\main\renderbuffer.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\main\rowthreads.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\swrast\s_aaline.h
 # End Source File
 # Begin Source File